@@ -0,0 +1,51 @@
+/**
+ * @file   lardataalg/DetectorInfo/AffineTransform.h
+ * @brief  Affine transformation of a single value, used for time conversions.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_AFFINETRANSFORM_H
+#define LARDATAALG_DETECTORINFO_AFFINETRANSFORM_H
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+
+namespace detinfo {
+
+  /// Affine transformation `value * scale + shift`.
+  struct AffineTransform {
+    double scale = 1.0;
+    double shift = 0.0;
+
+    constexpr double
+    operator()(double const value) const noexcept
+    {
+      return value * scale + shift;
+    }
+
+    /// Applies the transformation to `n` values from `in`, into `out`.
+    void
+    apply(double const* in, std::size_t const n, double* out) const noexcept
+    {
+      double const s = scale, sh = shift;
+      for (std::size_t i = 0; i < n; ++i)
+        out[i] = in[i] * s + sh;
+    }
+
+    /// Returns the inverse transformation.
+    constexpr AffineTransform
+    inverse() const noexcept
+    {
+      return {1.0 / scale, -shift / scale};
+    }
+
+    /// Returns the transformation applying this one, then `next`.
+    constexpr AffineTransform
+    then(AffineTransform const& next) const noexcept
+    {
+      return {scale * next.scale, shift * next.scale + next.shift};
+    }
+  }; // AffineTransform
+
+} // namespace detinfo
+
+#endif // LARDATAALG_DETECTORINFO_AFFINETRANSFORM_H
@@ -2,8 +2,11 @@
 #define LARDATAALG_DETECTORINFO_DETECTORCLOCKSDATA_H
 
 
+#include "lardataalg/DetectorInfo/AffineTransform.h"
 #include "lardataalg/DetectorInfo/ElecClock.h"
 
+#include <cstddef> // std::size_t
+
 namespace detinfo {
 
   /** **************************************************************************
@@ -339,7 +342,64 @@ namespace detinfo {
       , fOpticalClock{optical_clock}
       , fTriggerClock{trigger_clock}
       , fExternalClock{external_clock}
-    {}
+    {
+      fillConversions();
+    }
+
+    /// Time scales with a conversion table (see `Convert()`).
+    enum class TimeScale : unsigned int {
+      Electronics, ///< @ref DetectorClocksElectronicsTime "electronics time" [us]
+      Trigger,     ///< @ref DetectorClocksTriggerTime "trigger time" [us]
+      BeamGate,    ///< @ref DetectorClocksBeamGateTime "beam gate time" [us]
+      Simulation,  ///< @ref DetectorClocksSimulationTime "simulation time" [ns]
+      TPCTick,     ///< TPC waveform tick (from the start of the TPC readout)
+      TPCTDC,      ///< TPC electronics clock count [tdc]
+      OpticalTDC,  ///< optical electronics clock count [tdc]
+      ExternalTDC  ///< external electronics clock count [tdc]
+    };
+
+    /// Number of time scales in `TimeScale`.
+    static constexpr unsigned int NTimeScales = 8U;
+
+    /// Conversion between two time scales: `value * scale + shift`.
+    using Conversion_t = AffineTransform;
+
+    /**
+     * @brief Returns the conversion between two time scales.
+     *
+     * The conversions between all the pairs of time scales are computed at
+     * construction. They reproduce the dedicated conversion methods up to
+     * rounding: the single value methods (e.g. `Time2Tick(double)`) keep their
+     * own formulas, so that results truncated into tick and TDC bins do not
+     * change, while the batch methods use this table.
+     * Between TPC ticks and trigger or beam gate time the offset is
+     * `TriggerOffsetTPC()`, while with the other time scales the start of the
+     * TPC readout is `TPCTime()`. The two agree when the TPC trigger offset is
+     * configured in microseconds (i.e. negative).
+     */
+    Conversion_t const&
+    Conversion(TimeScale const from, TimeScale const to) const noexcept
+    {
+      return fConversions[static_cast<unsigned int>(from)][static_cast<unsigned int>(to)];
+    }
+
+    /// Converts `value` from the time scale `from` to the time scale `to`.
+    double
+    Convert(double const value, TimeScale const from, TimeScale const to) const noexcept
+    {
+      return Conversion(from, to)(value);
+    }
+
+    /// Converts `n` values from `in` (time scale `from`) into `out` (scale `to`).
+    void
+    Convert(double const* in,
+            std::size_t const n,
+            double* out,
+            TimeScale const from,
+            TimeScale const to) const noexcept
+    {
+      Conversion(from, to).apply(in, n, out);
+    }
 
     /**
      * @see `detinfo::DetectorClocks::TriggerOffsetTPC()`
@@ -356,6 +416,18 @@ namespace detinfo {
                                                            // us
     }
 
+    /**
+     * @brief Returns the TPC trigger offset as passed to the constructor.
+     *
+     * Negative values are in microseconds, the others in TPC ticks; see
+     * `TriggerOffsetTPC()` for the value in microseconds.
+     */
+    double
+    ConfiguredTriggerOffsetTPC() const
+    {
+      return fTriggerOffsetTPC;
+    }
+
     /// Returns the @ref DetectorClocksTPCelectronicsStartTime "TPC electronics start time"
     /// in @ref DetectorClocksElectronicsTime "electronics time".
     double
@@ -573,6 +645,173 @@ namespace detinfo {
     }
 
 
+    /// @{
+    /**
+     * @name Batch conversions
+     *
+     * These are the same as the conversions with the same name, applied to
+     * `n` values starting from the first input pointer, and writing into the
+     * `n` values starting from the output pointer (which may be the same as
+     * the input one). All the terms not depending on the value are combined
+     * once before the loop, so results may differ from the single value
+     * conversions by rounding. Optical and external clock conversions apply
+     * the same `sample` and `frame` to all the values.
+     */
+
+    void
+    TPCTick2TrigTime(double const* ticks, std::size_t const n, double* times) const noexcept
+    {
+      Convert(ticks, n, times, TimeScale::TPCTick, TimeScale::Trigger);
+    }
+    void
+    TPCTick2BeamTime(double const* ticks, std::size_t const n, double* times) const noexcept
+    {
+      Convert(ticks, n, times, TimeScale::TPCTick, TimeScale::BeamGate);
+    }
+    void
+    OpticalTick2TrigTime(double const* ticks,
+                         std::size_t const n,
+                         double* times,
+                         size_t const sample,
+                         size_t const frame) const noexcept
+    {
+      convertShifted(ticks,
+                     n,
+                     times,
+                     TimeScale::OpticalTDC,
+                     TimeScale::Trigger,
+                     fOpticalClock.Time(sample, frame));
+    }
+    void
+    OpticalTick2BeamTime(double const* ticks,
+                         std::size_t const n,
+                         double* times,
+                         size_t const sample,
+                         size_t const frame) const noexcept
+    {
+      convertShifted(ticks,
+                     n,
+                     times,
+                     TimeScale::OpticalTDC,
+                     TimeScale::BeamGate,
+                     fOpticalClock.Time(sample, frame));
+    }
+    void
+    ExternalTick2TrigTime(double const* ticks,
+                          std::size_t const n,
+                          double* times,
+                          size_t const sample,
+                          size_t const frame) const noexcept
+    {
+      convertShifted(ticks,
+                     n,
+                     times,
+                     TimeScale::ExternalTDC,
+                     TimeScale::Trigger,
+                     fExternalClock.Time(sample, frame));
+    }
+    void
+    ExternalTick2BeamTime(double const* ticks,
+                          std::size_t const n,
+                          double* times,
+                          size_t const sample,
+                          size_t const frame) const noexcept
+    {
+      convertShifted(ticks,
+                     n,
+                     times,
+                     TimeScale::ExternalTDC,
+                     TimeScale::BeamGate,
+                     fExternalClock.Time(sample, frame));
+    }
+    void
+    Time2Tick(double const* times, std::size_t const n, double* ticks) const noexcept
+    {
+      Convert(times, n, ticks, TimeScale::Electronics, TimeScale::TPCTick);
+    }
+    void
+    TPCTick2TDC(double const* ticks, std::size_t const n, double* tdcs) const noexcept
+    {
+      Convert(ticks, n, tdcs, TimeScale::TPCTick, TimeScale::TPCTDC);
+    }
+    void
+    TPCG4Time2TDC(double const* g4times, std::size_t const n, double* tdcs) const noexcept
+    {
+      Convert(g4times, n, tdcs, TimeScale::Simulation, TimeScale::TPCTDC);
+    }
+    void
+    OpticalTick2TDC(double const* ticks,
+                    std::size_t const n,
+                    double* tdcs,
+                    size_t const sample,
+                    size_t const frame) const noexcept
+    {
+      AffineTransform{1.0, static_cast<double>(fOpticalClock.Ticks(sample, frame))}.apply(
+        ticks, n, tdcs);
+    }
+    void
+    OpticalG4Time2TDC(double const* g4times, std::size_t const n, double* tdcs) const noexcept
+    {
+      Convert(g4times, n, tdcs, TimeScale::Simulation, TimeScale::OpticalTDC);
+    }
+    void
+    ExternalTick2TDC(double const* ticks,
+                     std::size_t const n,
+                     double* tdcs,
+                     size_t const sample,
+                     size_t const frame) const noexcept
+    {
+      AffineTransform{1.0, static_cast<double>(fExternalClock.Ticks(sample, frame))}.apply(
+        ticks, n, tdcs);
+    }
+    void
+    ExternalG4Time2TDC(double const* g4times, std::size_t const n, double* tdcs) const noexcept
+    {
+      Convert(g4times, n, tdcs, TimeScale::Simulation, TimeScale::ExternalTDC);
+    }
+    void
+    TPCTick2Time(double const* ticks, std::size_t const n, double* times) const noexcept
+    {
+      Convert(ticks, n, times, TimeScale::TPCTick, TimeScale::Electronics);
+    }
+    void
+    OpticalTick2Time(double const* ticks,
+                     std::size_t const n,
+                     double* times,
+                     size_t const sample,
+                     size_t const frame) const noexcept
+    {
+      AffineTransform{fOpticalClock.TickPeriod(), fOpticalClock.Time(sample, frame)}.apply(
+        ticks, n, times);
+    }
+    void
+    ExternalTick2Time(double const* ticks,
+                      std::size_t const n,
+                      double* times,
+                      size_t const sample,
+                      size_t const frame) const noexcept
+    {
+      AffineTransform{fExternalClock.TickPeriod(), fExternalClock.Time(sample, frame)}.apply(
+        ticks, n, times);
+    }
+    void
+    TPCTDC2Tick(double const* tdcs, std::size_t const n, double* ticks) const noexcept
+    {
+      Convert(tdcs, n, ticks, TimeScale::TPCTDC, TimeScale::TPCTick);
+    }
+    void
+    TPCG4Time2Tick(double const* g4times, std::size_t const n, double* ticks) const noexcept
+    {
+      Convert(g4times, n, ticks, TimeScale::Simulation, TimeScale::TPCTick);
+    }
+    void
+    G4ToElecTime(double const* g4times, std::size_t const n, double* times) const noexcept
+    {
+      Convert(g4times, n, times, TimeScale::Simulation, TimeScale::Electronics);
+    }
+
+    /// @}
+
     template <typename Stream>
     void debugReport(Stream& out) const
     {
@@ -612,6 +851,46 @@ namespace detinfo {
     ElecClock fTriggerClock;
     ElecClock fExternalClock;
 
+    /// Conversions between all pairs of time scales, `[from][to]`.
+    Conversion_t fConversions[NTimeScales][NTimeScales];
+
+    /// Fills the conversion table from the times and clocks.
+    void
+    fillConversions() noexcept
+    {
+      // each time scale as electronics time: `unit * value + origin`
+      struct TimeScaleDef_t {
+        double unit;
+        double origin;
+      };
+      TimeScaleDef_t const defs[NTimeScales] = {
+        {1.0, 0.0},                            // Electronics
+        {1.0, fTriggerTime},                   // Trigger
+        {1.0, fBeamGateTime},                  // BeamGate
+        {1.e-3, -fG4RefTime},                  // Simulation
+        {fTPCClock.TickPeriod(), doTPCTime()}, // TPCTick
+        {fTPCClock.TickPeriod(), 0.0},         // TPCTDC
+        {fOpticalClock.TickPeriod(), 0.0},     // OpticalTDC
+        {fExternalClock.TickPeriod(), 0.0}     // ExternalTDC
+      };
+      for (unsigned int from = 0; from < NTimeScales; ++from) {
+        for (unsigned int to = 0; to < NTimeScales; ++to) {
+          fConversions[from][to] = {defs[from].unit / defs[to].unit,
+                                    (defs[from].origin - defs[to].origin) / defs[to].unit};
+        }
+      }
+
+      // TPC ticks relate to trigger (and beam gate) through `TriggerOffsetTPC()`
+      double const period = fTPCClock.TickPeriod();
+      auto const setTPCTicks = [this, period](TimeScale const scale, double const offset) {
+        unsigned int const tick = static_cast<unsigned int>(TimeScale::TPCTick);
+        fConversions[tick][static_cast<unsigned int>(scale)] = {period, offset};
+        fConversions[static_cast<unsigned int>(scale)][tick] = {1.0 / period, -offset / period};
+      };
+      setTPCTicks(TimeScale::Trigger, TriggerOffsetTPC());
+      setTPCTicks(TimeScale::BeamGate, TriggerOffsetTPC() + TriggerTime() - BeamGateTime());
+    }
+
     /// Implementation of `TPCTime()`.
     double
     doTPCTime() const
@@ -619,6 +898,19 @@ namespace detinfo {
       return fTriggerTime + fTriggerOffsetTPC;
     }
 
+    /// Converts `n` values like `Convert()`, adding `extraShift` to each.
+    void
+    convertShifted(double const* in,
+                   std::size_t const n,
+                   double* out,
+                   TimeScale const from,
+                   TimeScale const to,
+                   double const extraShift) const noexcept
+    {
+      Conversion_t const& conv = Conversion(from, to);
+      AffineTransform{conv.scale, conv.shift + extraShift}.apply(in, n, out);
+    }
+
     /// Implementation of `Time2Tick()`.
     double
     doTime2Tick(double const time) const
@@ -27,6 +27,9 @@ detinfo::DetectorClocksStandard::DetectorClocksStandard(fhicl::ParameterSet cons
                  pset.get<double>(fConfigName[kDefaultBeamTime])}
   , fTrigModuleName{pset.get<std::string>("TrigModuleName")}
   , fG4RefCorrTrigModuleName{pset.get<std::string>("G4RefCorrTrigModuleName", "baddefault")}
+  , fTriggerSelection{
+      TriggerSelectionPolicy::fromName(pset.get<std::string>("TriggerSelection", "Single"),
+                                       pset.get<unsigned int>("TriggerSelectionBits", 0U))}
   , fTriggerOffsetTPC{fConfigValue[kTriggerOffsetTPC]}
   , fTriggerTime{fConfigValue[detinfo::kDefaultTrigTime]}
   , fBeamGateTime{fConfigValue[detinfo::kDefaultBeamTime]}
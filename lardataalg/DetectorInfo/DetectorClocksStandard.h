@@ -75,6 +75,12 @@ namespace detinfo {
    *     in the @ref DetectorClocksElectronicsTime "electronics time frame"
    * * *TrigModuleName* (_string_): input tag for the trigger data product
    *     (see "Trigger time" section below)
+   * * *TriggerSelection* (_string_, default: `Single`): how to choose the
+   *     trigger when the trigger data product has more than one; one of the
+   *     `detinfo::TriggerSelectionPolicy` modes (`Single`, `First`,
+   *     `Earliest`, `ByBits`, `All`)
+   * * *TriggerSelectionBits* (_integer_, default: `0`): trigger bits required
+   *     by `ByBits` trigger selection, where they must not be `0`
    * * *InheritClockConfig* (_boolean_): whether to inherit the configuration
    *     from previous jobs (see "Consistency check" below)
    *
@@ -156,6 +162,18 @@ namespace detinfo {
       return fG4RefCorrTrigModuleName;
     }
 
+    /**
+     * @brief Returns the policy choosing among multiple triggers in an event.
+     *
+     * The policy is set in the configuration as `TriggerSelection` and
+     * `TriggerSelectionBits`.
+     */
+    TriggerSelectionPolicy const&
+    TriggerSelection() const
+    {
+      return fTriggerSelection;
+    }
+
     std::vector<std::string> const&
     ConfigNames() const override
     {
@@ -243,6 +261,8 @@ namespace detinfo {
     std::string fTrigModuleName;
     std::string fG4RefCorrTrigModuleName;
 
+    TriggerSelectionPolicy fTriggerSelection;
+
     /// Time offset from trigger to TPC readout start
     double fTriggerOffsetTPC;
 
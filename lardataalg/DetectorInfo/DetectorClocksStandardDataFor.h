@@ -59,8 +59,7 @@ namespace detinfo {
    * The implementation is effectively dependent on the framework managing the
    * `event`, but it is not _formally_ dependent on any implementation.
    * Assumptions include everything that is required by other helper functions
-   * like `detinfo::trigger_times_for_event()` and
-   * `detinfo::g4ref_time_for_event()` (mostly, support for a call like
+   * like `detinfo::clock_times_for_event()` (mostly, support for a call like
    * `Event::getByLabel(art::InputTag, Event::HandleT<T>)`).
    */
   template <typename Event>
@@ -70,22 +69,94 @@ namespace detinfo {
   ) {
 
     auto const& config_values = detClocks.ConfigValues();
-    // Trigger times
+    // Trigger times (each trigger data product is read only once)
+    EventTriggerTimes_t const times = clock_times_for_event(detClocks.TrigModuleName(),
+                                                            detClocks.G4RefCorrTrigModuleName(),
+                                                            event,
+                                                            detClocks.TriggerSelection());
+
     double trig_time{config_values[kDefaultTrigTime]};
     double beam_time{config_values[kDefaultBeamTime]};
-    if (auto times = trigger_times_for_event(detClocks.TrigModuleName(), event)) {
-      std::tie(trig_time, beam_time) = *times;
-    }
+    if (times.triggerAndBeamGate) { std::tie(trig_time, beam_time) = *times.triggerAndBeamGate; }
 
     double g4_ref_time{config_values[kG4RefTime]};
-    if (auto sim_trig_time = g4ref_time_for_event(detClocks.G4RefCorrTrigModuleName(), event)) {
+    if (times.g4RefTriggerTime) {
       g4_ref_time -= trig_time;
-      g4_ref_time += *sim_trig_time;
+      g4_ref_time += *times.g4RefTriggerTime;
     }
     return detClocks.DataFor(g4_ref_time, trig_time, beam_time);
   } // detinfo::detectorClocksStandardDataFor()
 
 
+  /**
+   * @brief Returns `DetectorClocksData` for each trigger of the `event`.
+   * @tparam Event type of framework event
+   * @param detClocks service provider generating the data
+   * @param event event to read information from
+   * @return one `DetectorClocksData` for each selected trigger
+   * @see `detectorClocksStandardDataFor()`
+   *
+   * This function is like `detectorClocksStandardDataFor()`, but when the
+   * trigger data product holds more than one trigger, it returns the data of
+   * each of the triggers chosen by `detClocks.TriggerSelection()` (e.g. all
+   * of them, with the `All` policy).
+   * If no trigger is found, a single `DetectorClocksData` with the default
+   * trigger and beam gate times is returned.
+   *
+   * When the G4 reference correction is read from the same data product as
+   * the triggers, each trigger is its own reference; otherwise, the data
+   * product of the G4 reference must hold a single trigger, whatever the
+   * selection policy.
+   */
+  template <typename Event>
+  std::vector<detinfo::DetectorClocksData> detectorClocksStandardDataForTriggers(
+    detinfo::DetectorClocksStandard const& detClocks,
+    Event const& event
+  ) {
+
+    auto const& config_values = detClocks.ConfigValues();
+    art::InputTag const triggerTag{detClocks.TrigModuleName()};
+    art::InputTag const g4RefTag{detClocks.G4RefCorrTrigModuleName()};
+    TriggerSelectionPolicy const& selection = detClocks.TriggerSelection();
+
+    std::vector<raw::Trigger> const triggers
+      = selected_triggers_for_event(triggerTag, event, selection);
+
+    // when each trigger is its own G4 reference, the correction cancels
+    bool const selfReference = (g4RefTag == triggerTag);
+
+    std::vector<detinfo::DetectorClocksData> data;
+    if (triggers.empty()) {
+      double const trig_time{config_values[kDefaultTrigTime]};
+      double g4_ref_time{config_values[kG4RefTime]};
+      auto const sim_trig_time = selfReference
+        ? std::nullopt: g4ref_time_for_event(g4RefTag, event);
+      if (sim_trig_time) {
+        g4_ref_time -= trig_time;
+        g4_ref_time += *sim_trig_time;
+      }
+      data.push_back
+        (detClocks.DataFor(g4_ref_time, trig_time, config_values[kDefaultBeamTime]));
+      return data;
+    }
+
+    std::optional<double> const sim_trig_time = selfReference
+      ? std::nullopt: g4ref_time_for_event(g4RefTag, event);
+
+    data.reserve(triggers.size());
+    for (raw::Trigger const& trigger: triggers) {
+      double const trig_time = trigger.TriggerTime();
+      double g4_ref_time{config_values[kG4RefTime]};
+      if (sim_trig_time) {
+        g4_ref_time -= trig_time;
+        g4_ref_time += *sim_trig_time;
+      }
+      data.push_back(detClocks.DataFor(g4_ref_time, trig_time, trigger.BeamGateTime()));
+    } // for
+    return data;
+  } // detinfo::detectorClocksStandardDataForTriggers()
+
+
 } // namespace detinfo
 
 
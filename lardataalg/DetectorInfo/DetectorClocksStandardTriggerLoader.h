@@ -30,54 +30,250 @@
 #include "cetlib_except/exception.h"
 
 // C++ standard libraries
+#include <algorithm> // std::min_element()
+#include <ios>       // std::hex, std::dec
 #include <optional>
+#include <string>
+#include <utility> // std::pair
 #include <vector>
 
 namespace detinfo {
 
   /**
-   * @brief Loads `DetectorClocksStandard` trigger times.
+   * @brief Policy choosing the triggers of an event when there are many.
+   *
+   * The loaders in this header read a `raw::Trigger` collection and select
+   * from it the triggers to use, according to the `mode`:
+   *
+   * * `Single` (default): the collection must contain at most one trigger,
+   *   otherwise an exception is thrown (this is the historical behaviour);
+   * * `First`: the first trigger in the collection;
+   * * `Earliest`: the trigger with the smallest trigger time;
+   * * `ByBits`: the triggers with all the bits in `bits` set
+   *   (`raw::Trigger::TriggerBits()`); `bits` must not be `0`, and an
+   *   exception is thrown if no trigger in a non-empty collection has them;
+   * * `All`: all the triggers.
+   *
+   * The loaders returning the times of a single trigger (like
+   * `trigger_times_for_event()`) throw an exception if the policy selects more
+   * than one trigger, e.g. on `ByBits` matching more triggers, and on `All`
+   * with more than one trigger. All the selected triggers are returned by
+   * `selected_triggers_for_event()` and used by
+   * `detectorClocksStandardDataForTriggers()`.
+   *
+   * The policy applies to the readout trigger only: the trigger used as G4
+   * reference, when read from a different data product, is always required to
+   * be the only one there (`Single`).
+   */
+  struct TriggerSelectionPolicy {
+    enum class Mode { Single, First, Earliest, ByBits, All };
+
+    Mode mode = Mode::Single;
+    unsigned int bits = 0U; ///< Required trigger bits for `ByBits` mode.
+
+    /**
+     * @brief Returns the policy with the specified mode name.
+     * @param name name of the mode (`"Single"`, `"First"`, `"Earliest"`,
+     *             `"ByBits"` or `"All"`)
+     * @param bits required trigger bits for `"ByBits"` mode
+     * @throws cet::exception (category `"TriggerSelectionPolicy"`) if the
+     *                        mode name is not known, or if `bits` is `0` in
+     *                        `"ByBits"` mode (every trigger would match)
+     */
+    static TriggerSelectionPolicy
+    fromName(std::string const& name, unsigned int const bits = 0U)
+    {
+      if (name == "Single") return {Mode::Single, bits};
+      if (name == "First") return {Mode::First, bits};
+      if (name == "Earliest") return {Mode::Earliest, bits};
+      if (name == "ByBits") {
+        if (bits == 0U) {
+          throw cet::exception("TriggerSelectionPolicy")
+            << "Trigger selection mode 'ByBits' requires non-zero trigger bits\n";
+        }
+        return {Mode::ByBits, bits};
+      }
+      if (name == "All") return {Mode::All, bits};
+      throw cet::exception("TriggerSelectionPolicy")
+        << "Unknown trigger selection mode '" << name
+        << "' (supported: Single, First, Earliest, ByBits, All)\n";
+    }
+  }; // TriggerSelectionPolicy
+
+  /**
+   * @brief Returns the triggers in the data product `triggerTag` chosen by `selection`.
    * @tparam Event type of event where trigger data might be stored
    * @param triggerTag tag of the `raw::Trigger` collection data product to read
    * @param event the event the trigger objects are stored into
-   * @return optional pair of trigger and beam gate time, empty if not found
+   * @param selection policy choosing the triggers
+   * @return a copy of the selected triggers, empty if none is found
    * @throws cet::exception (category `"setDetectorClocksStandardTrigger"`)
-   *                        if trigger data product has more than one trigger
-   *
-   * This function returns the relative trigger and beam gate times read from an `event`.
-   * It attempts to read the information from a `raw::Trigger` collection data product
-   * with tag `triggerTag` in the `event`. Times are expected to be in microseconds
-   * on the electronics time scale.
-   * In case that data product does not exist, or it exists but empty,
-   * an empty result is quietly returned.
-   * If instead there are multiple trigger objects in the collection,
-   * no choice is made, and an exception is thrown.
+   *                        with `Single` policy, if there is more than one trigger,
+   *                        and with `ByBits` policy, if no trigger has the bits
    */
   template <typename Event>
-  std::optional<std::pair<double, double>>
-  trigger_times_for_event(art::InputTag const& triggerTag, Event const& event)
+  std::vector<raw::Trigger>
+  selected_triggers_for_event(art::InputTag const& triggerTag,
+                              Event const& event,
+                              TriggerSelectionPolicy const& selection = {})
   {
-    // try to read the trigger from the event
     // fetch the trigger data product
     using TriggerHandle_t = typename Event::template HandleT<std::vector<raw::Trigger>>;
 
     TriggerHandle_t triggerHandle;
-    if (!event.template getByLabel(triggerTag, triggerHandle)) { return std::nullopt; }
+    if (!event.template getByLabel(triggerTag, triggerHandle)) { return {}; }
 
-    // check that we do have a trigger
     // (we have already checked whether the handle is valid above)
     auto const& triggers = *triggerHandle;
-    if (triggers.empty()) { return std::nullopt; }
+    if (triggers.empty()) { return {}; }
+
+    using Mode = TriggerSelectionPolicy::Mode;
+    switch (selection.mode) {
+    case Mode::First: return {triggers.front()};
+    case Mode::Earliest:
+      return {*std::min_element(
+        triggers.begin(), triggers.end(), [](raw::Trigger const& a, raw::Trigger const& b) {
+          return a.TriggerTime() < b.TriggerTime();
+        })};
+    case Mode::ByBits: {
+      std::vector<raw::Trigger> selected;
+      for (raw::Trigger const& trigger : triggers) {
+        if ((trigger.TriggerBits() & selection.bits) == selection.bits)
+          selected.push_back(trigger);
+      }
+      if (selected.empty()) {
+        throw cet::exception("setDetectorClocksStandardTrigger")
+          << "None of the " << triggers.size() << " trigger objects in '" << triggerTag.encode()
+          << "' has all the trigger bits 0x" << std::hex << selection.bits << std::dec
+          << " set\n";
+      }
+      return selected;
+    }
+    case Mode::Single:
+      // select which trigger to set (i.e., the only one!)
+      if (triggers.size() != 1) {
+        throw cet::exception("setDetectorClocksStandardTrigger")
+          << "Found " << triggers.size() << " trigger objects in '" << triggerTag.encode()
+          << "' (only one trigger per event is supported)\n";
+      }
+      break;
+    case Mode::All: break;
+    } // switch
+    return triggers;
+  }
+
+  namespace details {
+
+    /**
+     * @brief Returns the only trigger selected in the data product `triggerTag`.
+     * @return a copy of the trigger, empty if not found
+     * @throws cet::exception (category `"setDetectorClocksStandardTrigger"`)
+     *                        if more than one trigger is selected
+     *
+     * This is the single data product lookup behind all the loaders of a
+     * single trigger in this header.
+     */
+    template <typename Event>
+    std::optional<raw::Trigger>
+    single_trigger_for_event(art::InputTag const& triggerTag,
+                             Event const& event,
+                             TriggerSelectionPolicy const& selection)
+    {
+      std::vector<raw::Trigger> const triggers =
+        selected_triggers_for_event(triggerTag, event, selection);
+      if (triggers.empty()) { return std::nullopt; }
+
+      if (triggers.size() != 1) {
+        throw cet::exception("setDetectorClocksStandardTrigger")
+          << triggers.size() << " trigger objects selected in '" << triggerTag.encode()
+          << "' (only one trigger is supported here)\n";
+      }
+
+      return std::make_optional(triggers.front());
+    }
+
+  } // namespace details
+
+  /// Times read from the trigger data products of an event.
+  struct EventTriggerTimes_t {
+    /// Trigger and beam gate time, empty if not found.
+    std::optional<std::pair<double, double>> triggerAndBeamGate;
+
+    /// Trigger time used as G4 reference time, empty if not found.
+    std::optional<double> g4RefTriggerTime;
+  };
+
+  /**
+   * @brief Loads all the `DetectorClocksStandard` times from an event.
+   * @tparam Event type of event where trigger data might be stored
+   * @param triggerTag tag of the `raw::Trigger` collection with the trigger
+   * @param g4RefTag tag of the `raw::Trigger` collection with the G4 reference
+   * @param event the event the trigger objects are stored into
+   * @param selection policy choosing the readout trigger
+   * @return the times found in the event
+   * @throws cet::exception (category `"setDetectorClocksStandardTrigger"`)
+   *                        if more than one trigger is selected in a data product
+   *
+   * This function returns together what `trigger_times_for_event()` and
+   * `g4ref_time_for_event()` return, with the same rules.
+   * The `selection` policy applies to the readout trigger: the G4 reference
+   * is the same trigger when the two tags are the same, as is common, and the
+   * data product is then read only once; otherwise, the data product `g4RefTag`
+   * must hold a single trigger.
+   */
+  template <typename Event>
+  EventTriggerTimes_t
+  clock_times_for_event(art::InputTag const& triggerTag,
+                        art::InputTag const& g4RefTag,
+                        Event const& event,
+                        TriggerSelectionPolicy const& selection = {})
+  {
+    EventTriggerTimes_t times;
 
-    // select which trigger to set (i.e., the only one!)
-    if (triggers.size() != 1) {
-      throw cet::exception("setDetectorClocksStandardTrigger")
-        << "Found " << triggers.size() << " trigger objects in '" << triggerTag.encode()
-        << "' (only one trigger per event is supported)\n";
+    std::optional<raw::Trigger> const trigger =
+      details::single_trigger_for_event(triggerTag, event, selection);
+    if (trigger) {
+      times.triggerAndBeamGate.emplace(trigger->TriggerTime(), trigger->BeamGateTime());
     }
 
-    auto const& trigger = triggers.front();
-    return std::make_optional(std::make_pair(trigger.TriggerTime(), trigger.BeamGateTime()));
+    std::optional<raw::Trigger> const g4RefTrigger =
+      (g4RefTag == triggerTag) ? trigger : details::single_trigger_for_event(g4RefTag, event, {});
+    if (g4RefTrigger) times.g4RefTriggerTime.emplace(g4RefTrigger->TriggerTime());
+
+    return times;
+  }
+
+  /**
+   * @brief Loads `DetectorClocksStandard` trigger times.
+   * @tparam Event type of event where trigger data might be stored
+   * @param triggerTag tag of the `raw::Trigger` collection data product to read
+   * @param event the event the trigger objects are stored into
+   * @param selection policy choosing the trigger (by default, the only one)
+   * @return optional pair of trigger and beam gate time, empty if not found
+   * @throws cet::exception (category `"setDetectorClocksStandardTrigger"`)
+   *                        if more than one trigger is selected
+   * @see `clock_times_for_event()`
+   *
+   * This function returns the relative trigger and beam gate times read from an `event`.
+   * It attempts to read the information from a `raw::Trigger` collection data product
+   * with tag `triggerTag` in the `event`. Times are expected to be in microseconds
+   * on the electronics time scale.
+   * In case that data product does not exist, or it exists but empty,
+   * an empty result is quietly returned.
+   * If instead there are multiple trigger objects in the collection, the
+   * `selection` policy chooses among them; by default, no choice is made, and
+   * an exception is thrown.
+   */
+  template <typename Event>
+  std::optional<std::pair<double, double>>
+  trigger_times_for_event(art::InputTag const& triggerTag,
+                          Event const& event,
+                          TriggerSelectionPolicy const& selection = {})
+  {
+    std::optional<raw::Trigger> const trigger =
+      details::single_trigger_for_event(triggerTag, event, selection);
+    if (!trigger) return std::nullopt;
+    return std::make_optional(std::make_pair(trigger->TriggerTime(), trigger->BeamGateTime()));
   }
 
   /**
@@ -85,9 +281,11 @@ namespace detinfo {
    * @tparam Event type of event where trigger data might be stored
    * @param triggerTag tag of the `raw::Trigger` collection data product to read
    * @param event the event the trigger objects are stored into
+   * @param selection policy choosing the trigger (by default, the only one)
    * @return optional G4 reference time value, empty if not found
    * @throws cet::exception (category `"setDetectorClocksStandardTrigger"`)
-   *                        if trigger data product has more than one trigger
+   *                        if more than one trigger is selected
+   * @see `clock_times_for_event()`
    *
    * This function returns the simulation (G4) reference time from an `event`.
    * It is assumed to match the trigger time (or, it is assumed that the trigger
@@ -97,32 +295,20 @@ namespace detinfo {
    * in microseconds on the electronics time scale.
    * In case that data product does not exist, or it exists but empty,
    * an empty result is quietly returned.
-   * If instead there are multiple trigger objects in the collection,
-   * no choice is made, and an exception is thrown.
-      */
+   * If instead there are multiple trigger objects in the collection, the
+   * `selection` policy chooses among them; by default, no choice is made, and
+   * an exception is thrown.
+   */
   template <typename Event>
   std::optional<double>
-  g4ref_time_for_event(art::InputTag const& triggerTag, Event const& event)
+  g4ref_time_for_event(art::InputTag const& triggerTag,
+                       Event const& event,
+                       TriggerSelectionPolicy const& selection = {})
   {
-    // fetch the trigger data product
-    using TriggerHandle_t = typename Event::template HandleT<std::vector<raw::Trigger>>;
-
-    TriggerHandle_t triggerHandle;
-    if (!event.template getByLabel(triggerTag, triggerHandle)) return std::nullopt;
-
-    // check that we do have a trigger
-    // (we have already checked whether the handle is valid above)
-    auto const& triggers = *triggerHandle;
-    if (triggers.empty()) return std::nullopt;
-
-    // select which trigger to set (i.e., the only one!)
-    if (triggers.size() != 1) {
-      throw cet::exception("setDetectorClocksStandardTrigger")
-        << "Found " << triggers.size() << " trigger objects in '" << triggerTag.encode()
-        << "' (only one trigger per event is supported)\n";
-    }
-
-    return std::make_optional(triggers.front().TriggerTime());
+    std::optional<raw::Trigger> const trigger =
+      details::single_trigger_for_event(triggerTag, event, selection);
+    if (!trigger) return std::nullopt;
+    return std::make_optional(trigger->TriggerTime());
   }
 
 } // namespace detinfo
@@ -0,0 +1,394 @@
+#include "lardataalg/DetectorInfo/DetectorInfoSnapshot.h"
+#include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// POSIX
+#include <fcntl.h>    // open()
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // close()
+
+// C/C++ standard libraries
+#include <cstring> // std::memcpy()
+#include <fstream>
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::move()
+#include <vector>
+
+namespace {
+
+  constexpr char FileMagic[8] = {'D', 'E', 'T', 'I', 'N', 'F', 'O', 'S'};
+  constexpr std::uint64_t ByteOrderMark = 0x0102030405060708ULL;
+  constexpr std::size_t NHeaderWords = 6U;
+
+  /// 64-bit FNV-1a hash of `size` bytes starting at `data`.
+  std::uint64_t
+  fnv1a(void const* data, std::size_t const size) noexcept
+  {
+    auto const* bytes = static_cast<unsigned char const*>(data);
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+      hash ^= bytes[i];
+      hash *= 0x100000001b3ULL;
+    }
+    return hash;
+  }
+
+  std::uint64_t
+  toWord(double const value) noexcept
+  {
+    std::uint64_t word;
+    std::memcpy(&word, &value, sizeof(word));
+    return word;
+  }
+
+  double
+  toDouble(std::uint64_t const word) noexcept
+  {
+    double value;
+    std::memcpy(&value, &word, sizeof(value));
+    return value;
+  }
+
+  /// Sequential reader of the words of a snapshot, checking the size.
+  class WordReader {
+  public:
+    WordReader(std::string const& fileName, std::uint64_t const* words, std::size_t const nWords)
+      : fFileName{fileName}, fNext{words}, fEnd{words + nWords}
+    {}
+
+    std::uint64_t
+    word()
+    {
+      if (fNext == fEnd)
+        throw std::runtime_error("DetectorInfoSnapshot: '" + fFileName + "' is truncated");
+      return *(fNext++);
+    }
+
+    double
+    real()
+    {
+      return toDouble(word());
+    }
+
+    bool
+    atEnd() const noexcept
+    {
+      return fNext == fEnd;
+    }
+
+  private:
+    std::string const& fFileName;
+    std::uint64_t const* fNext;
+    std::uint64_t const* fEnd;
+  }; // WordReader
+
+  /// A read-only memory mapping of a whole file, released on destruction.
+  class MappedFile {
+  public:
+    explicit MappedFile(std::string const& fileName)
+    {
+      int const fd = ::open(fileName.c_str(), O_RDONLY);
+      if (fd < 0) throw std::runtime_error("DetectorInfoSnapshot: can't open '" + fileName + "'");
+      struct stat info;
+      if (::fstat(fd, &info) == 0) fSize = info.st_size;
+      if (fSize > 0U) fData = ::mmap(nullptr, fSize, PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+      if (fData == MAP_FAILED) {
+        fData = nullptr;
+        throw std::runtime_error("DetectorInfoSnapshot: can't map '" + fileName + "'");
+      }
+    }
+
+    ~MappedFile()
+    {
+      if (fData) ::munmap(fData, fSize);
+    }
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    std::uint64_t const*
+    words() const noexcept
+    {
+      return static_cast<std::uint64_t const*>(fData);
+    }
+
+    std::size_t
+    nWords() const noexcept
+    {
+      return fData ? (fSize / sizeof(std::uint64_t)) : 0U;
+    }
+
+  private:
+    void* fData = nullptr;
+    std::size_t fSize = 0U;
+  }; // MappedFile
+
+  void
+  appendClock(std::vector<std::uint64_t>& words, detinfo::ElecClock const& clock)
+  {
+    words.push_back(toWord(clock.Time()));
+    words.push_back(toWord(clock.FramePeriod()));
+    words.push_back(toWord(clock.Frequency()));
+  }
+
+  detinfo::ElecClock
+  readClock(WordReader& reader)
+  {
+    double const time = reader.real();
+    double const framePeriod = reader.real();
+    double const frequency = reader.real();
+    return {time, framePeriod, frequency};
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+detinfo::DetectorInfoSnapshot::DetectorInfoSnapshot(std::string const& fileName,
+                                                    std::uint64_t const configChecksum)
+  : DetectorInfoSnapshot{[&fileName, configChecksum] {
+    MappedFile const file{fileName};
+    return decode(fileName, file.words(), file.nWords(), configChecksum);
+  }()}
+{}
+
+detinfo::DetectorInfoSnapshot::DetectorInfoSnapshot(std::uint64_t const configChecksum,
+                                                    DetectorClocksData const& clockData,
+                                                    Physics_t const& physics,
+                                                    std::shared_ptr<XTicksTable const> xTicks)
+  : fConfigChecksum{configChecksum}
+  , fClocksData{clockData}
+  , fPhysics{physics}
+  , fXTicks{std::move(xTicks)}
+{}
+
+//------------------------------------------------------------------------------
+detinfo::DetectorPropertiesData
+detinfo::DetectorInfoSnapshot::PropertiesData(DetectorProperties const& properties) const
+{
+  DetectorPropertiesData data{properties, fPhysics.xTicksCoefficient, fXTicks};
+  bool const matches = (data.Efield() == fPhysics.efield) &&
+                       (data.Temperature() == fPhysics.temperature) &&
+                       (data.Density() == fPhysics.density) &&
+                       (data.ElectronLifetime() == fPhysics.electronLifetime) &&
+                       (data.ElectronsToADC() == fPhysics.electronsToADC) &&
+                       (data.TimeOffsetU() == fPhysics.timeOffsetU) &&
+                       (data.TimeOffsetV() == fPhysics.timeOffsetV) &&
+                       (data.TimeOffsetZ() == fPhysics.timeOffsetZ) &&
+                       (data.HasTimeOffsetY() == (fPhysics.hasTimeOffsetY != 0U)) &&
+                       (!data.HasTimeOffsetY() || (data.TimeOffsetY() == fPhysics.timeOffsetY)) &&
+                       (data.NumberTimeSamples() == fPhysics.numberTimeSamples) &&
+                       (data.ReadOutWindowSize() == fPhysics.readOutWindowSize) &&
+                       (data.SimpleBoundary() == (fPhysics.simpleBoundary != 0U));
+  if (!matches) {
+    throw std::runtime_error(
+      "DetectorInfoSnapshot: the detector properties provider does not match the snapshot");
+  }
+  return data;
+}
+
+//------------------------------------------------------------------------------
+void
+detinfo::DetectorInfoSnapshot::Write(std::string const& fileName,
+                                     DetectorClocksData const& clockData,
+                                     DetectorPropertiesData const& propData,
+                                     std::uint64_t const configChecksum)
+{
+  std::vector<std::uint64_t> payload;
+
+  // clocks
+  payload.push_back(toWord(-clockData.G4ToElecTime(0.0))); // Geant4 reference time
+  payload.push_back(toWord(clockData.ConfiguredTriggerOffsetTPC()));
+  payload.push_back(toWord(clockData.TriggerTime()));
+  payload.push_back(toWord(clockData.BeamGateTime()));
+  appendClock(payload, clockData.TPCClock());
+  appendClock(payload, clockData.OpticalClock());
+  appendClock(payload, clockData.TriggerClock());
+  appendClock(payload, clockData.ExternalClock());
+
+  // properties
+  XTicksTable const& table = propData.XTicks();
+  std::uint64_t nTPCs = 0U, nPlanes = 0U;
+  for (unsigned int c = 0; c < table.NCryostats(); ++c) {
+    nTPCs += table.NTPCs(c);
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t)
+      nPlanes += table.NPlanes(t, c);
+  }
+  payload.push_back(toWord(propData.GetXTicksCoefficient()));
+  payload.push_back(toWord(propData.Efield()));
+  payload.push_back(toWord(propData.Temperature()));
+  payload.push_back(toWord(propData.Density()));
+  payload.push_back(toWord(propData.ElectronLifetime()));
+  payload.push_back(toWord(propData.ElectronsToADC()));
+  payload.push_back(toWord(propData.TimeOffsetU()));
+  payload.push_back(toWord(propData.TimeOffsetV()));
+  payload.push_back(toWord(propData.TimeOffsetZ()));
+  payload.push_back(propData.HasTimeOffsetY() ? 1U : 0U);
+  payload.push_back(toWord(propData.HasTimeOffsetY() ? propData.TimeOffsetY() : 0.0));
+  payload.push_back(propData.NumberTimeSamples());
+  payload.push_back(propData.ReadOutWindowSize());
+  payload.push_back(propData.SimpleBoundary() ? 1U : 0U);
+  payload.push_back(table.NCryostats());
+  payload.push_back(nTPCs);
+  payload.push_back(nPlanes);
+
+  // conversion table
+  for (unsigned int c = 0; c < table.NCryostats(); ++c)
+    payload.push_back(table.NTPCs(c));
+  for (unsigned int c = 0; c < table.NCryostats(); ++c)
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t)
+      payload.push_back(table.NPlanes(t, c));
+  for (unsigned int c = 0; c < table.NCryostats(); ++c)
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t)
+      payload.push_back(toWord(table.Coefficient(t, c)));
+  for (unsigned int c = 0; c < table.NCryostats(); ++c)
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t)
+      for (unsigned int p = 0; p < table.NPlanes(t, c); ++p)
+        payload.push_back(toWord(table.Offset(p, t, c)));
+
+  std::size_t const payloadSize = payload.size() * sizeof(std::uint64_t);
+  std::uint64_t magic;
+  std::memcpy(&magic, FileMagic, sizeof(magic));
+  std::uint64_t const header[NHeaderWords] = {magic,
+                                              FormatVersion,
+                                              ByteOrderMark,
+                                              configChecksum,
+                                              fnv1a(payload.data(), payloadSize),
+                                              payloadSize};
+
+  std::ofstream file{fileName, std::ios::binary};
+  if (!file) throw std::runtime_error("DetectorInfoSnapshot: can't create '" + fileName + "'");
+  file.write(reinterpret_cast<char const*>(header), sizeof(header));
+  file.write(reinterpret_cast<char const*>(payload.data()), payloadSize);
+  if (!file) throw std::runtime_error("DetectorInfoSnapshot: error writing '" + fileName + "'");
+}
+
+//------------------------------------------------------------------------------
+std::uint64_t
+detinfo::DetectorInfoSnapshot::ConfigurationChecksum(std::string const& configuration) noexcept
+{
+  return fnv1a(configuration.data(), configuration.size());
+}
+
+//------------------------------------------------------------------------------
+detinfo::DetectorInfoSnapshot
+detinfo::DetectorInfoSnapshot::decode(std::string const& fileName,
+                                      std::uint64_t const* words,
+                                      std::size_t const nWords,
+                                      std::uint64_t const configChecksum)
+{
+  if ((nWords < NHeaderWords) || (std::memcmp(words, FileMagic, sizeof(FileMagic)) != 0)) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' is not a snapshot file");
+  }
+  if (words[1] != FormatVersion) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' has format version " +
+                             std::to_string(words[1]) + ", only version " +
+                             std::to_string(FormatVersion) + " is supported");
+  }
+  if (words[2] != ByteOrderMark) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName +
+                             "' was written with a different byte order");
+  }
+  if (words[3] != configChecksum) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName +
+                             "' was written with a different configuration");
+  }
+  std::uint64_t const payloadSize = words[5];
+  if (payloadSize != (nWords - NHeaderWords) * sizeof(std::uint64_t)) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' has the wrong size");
+  }
+  if (fnv1a(words + NHeaderWords, payloadSize) != words[4]) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' is corrupted");
+  }
+
+  WordReader reader{fileName, words + NHeaderWords, nWords - NHeaderWords};
+
+  // clocks
+  double const g4RefTime = reader.real();
+  double const triggerOffsetTPC = reader.real();
+  double const triggerTime = reader.real();
+  double const beamGateTime = reader.real();
+  ElecClock const tpcClock = readClock(reader);
+  ElecClock const opticalClock = readClock(reader);
+  ElecClock const triggerClock = readClock(reader);
+  ElecClock const externalClock = readClock(reader);
+  DetectorClocksData const clockData{g4RefTime,
+                                     triggerOffsetTPC,
+                                     triggerTime,
+                                     beamGateTime,
+                                     tpcClock,
+                                     opticalClock,
+                                     triggerClock,
+                                     externalClock};
+
+  // properties
+  Physics_t physics;
+  physics.xTicksCoefficient = reader.real();
+  physics.efield = reader.real();
+  physics.temperature = reader.real();
+  physics.density = reader.real();
+  physics.electronLifetime = reader.real();
+  physics.electronsToADC = reader.real();
+  physics.timeOffsetU = reader.real();
+  physics.timeOffsetV = reader.real();
+  physics.timeOffsetZ = reader.real();
+  physics.hasTimeOffsetY = reader.word();
+  physics.timeOffsetY = reader.real();
+  physics.numberTimeSamples = reader.word();
+  physics.readOutWindowSize = reader.word();
+  physics.simpleBoundary = reader.word();
+  std::uint64_t const nCryostats = reader.word();
+  std::uint64_t const nTPCs = reader.word();
+  std::uint64_t const nPlanes = reader.word();
+  if ((nCryostats > nWords) || (nTPCs > nWords) || (nPlanes > nWords)) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' has an invalid layout");
+  }
+
+  // conversion table; the counts must add up to the totals in the header
+  std::vector<std::uint64_t> tpcsInCryostat(nCryostats);
+  std::uint64_t totalTPCs = 0U;
+  for (std::uint64_t& tpcs : tpcsInCryostat) {
+    tpcs = reader.word();
+    if (tpcs > nTPCs) {
+      throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' has an invalid layout");
+    }
+    totalTPCs += tpcs;
+  }
+  if (totalTPCs != nTPCs) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' has an invalid layout");
+  }
+  std::vector<std::vector<unsigned int>> layout(nCryostats);
+  std::uint64_t totalPlanes = 0U;
+  for (std::size_t c = 0; c < nCryostats; ++c) {
+    layout[c].resize(tpcsInCryostat[c]);
+    for (unsigned int& planes : layout[c]) {
+      std::uint64_t const count = reader.word();
+      if (count > nPlanes) {
+        throw std::runtime_error("DetectorInfoSnapshot: '" + fileName +
+                                 "' has an invalid layout");
+      }
+      planes = count;
+      totalPlanes += count;
+    }
+  }
+  if (totalPlanes != nPlanes) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' has an invalid layout");
+  }
+  XTicksTable table{layout};
+  for (unsigned int c = 0; c < nCryostats; ++c)
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t)
+      table.SetCoefficient(t, c, reader.real());
+  for (unsigned int c = 0; c < nCryostats; ++c)
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t)
+      for (unsigned int p = 0; p < table.NPlanes(t, c); ++p)
+        table.SetOffset(p, t, c, reader.real());
+  if (!reader.atEnd()) {
+    throw std::runtime_error("DetectorInfoSnapshot: '" + fileName + "' has an invalid layout");
+  }
+
+  return {configChecksum,
+          clockData,
+          physics,
+          std::make_shared<XTicksTable const>(std::move(table))};
+}
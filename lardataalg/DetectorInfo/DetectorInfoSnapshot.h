@@ -0,0 +1,160 @@
+/**
+ * @file   lardataalg/DetectorInfo/DetectorInfoSnapshot.h
+ * @brief  Binary snapshot of the detector clocks and properties data.
+ * @see    lardataalg/DetectorInfo/DetectorInfoSnapshot.cc
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_DETECTORINFOSNAPSHOT_H
+#define LARDATAALG_DETECTORINFO_DETECTORINFOSNAPSHOT_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint64_t
+#include <memory>  // std::shared_ptr
+#include <string>
+
+namespace detinfo {
+
+  class DetectorProperties;
+
+  /**
+   * @brief Precomputed `DetectorClocksData` and `DetectorPropertiesData`.
+   *
+   * A snapshot is written once, e.g. by a job with the complete
+   * configuration, and then loaded by jobs and tools which need the same
+   * data, without rebuilding them.
+   *
+   * The snapshot is tagged with a checksum of the configuration it was
+   * obtained from (see `ConfigurationChecksum()`); loading requires the
+   * checksum of the current configuration, and fails if they differ.
+   *
+   * File format
+   * ------------
+   *
+   * The file is a sequence of 64-bit words in the byte order of the machine
+   * which wrote it, so that it can be memory-mapped and read in place:
+   *
+   * 1. header: magic `DETINFOS`, format version, byte order mark
+   *    `0x0102030405060708`, configuration checksum, payload checksum,
+   *    payload size [bytes];
+   * 2. clocks: Geant4 reference time [us], TPC trigger offset as configured
+   *    (see `DetectorClocksData::ConfiguredTriggerOffsetTPC()`), trigger time
+   *    and beam gate time [us], then time, frame period [us] and frequency [MHz]
+   *    of TPC, optical, trigger and external clocks;
+   * 3. properties: x/ticks coefficient [cm/tick], electric field, temperature,
+   *    density, electron lifetime, electrons per ADC count, time offsets of
+   *    views U, V and Z, a flag whether the provider implements the time
+   *    offset of view Y and that offset (`0` if not implemented), then the
+   *    integers: number of time samples, readout window size, simple boundary
+   *    flag, number of cryostats, of TPCs and of planes;
+   * 4. conversion table: number of TPCs in each cryostat, of planes in each
+   *    TPC, then the coefficient of each TPC and the offset of each plane.
+   *
+   * The payload checksum is a 64-bit FNV-1a hash of sections 2 to 4.
+   */
+  class DetectorInfoSnapshot {
+  public:
+    /// Version of the file format written by this code.
+    static constexpr std::uint64_t FormatVersion = 3U;
+
+    /**
+     * @brief Loads a snapshot from file.
+     * @param fileName path of the snapshot file
+     * @param configChecksum checksum of the current configuration
+     * @throw std::runtime_error if the file can't be read, is not a valid
+     *        snapshot, is corrupted or does not match `configChecksum`
+     */
+    DetectorInfoSnapshot(std::string const& fileName, std::uint64_t configChecksum);
+
+    /// Returns the checksum of the configuration of this snapshot.
+    std::uint64_t
+    ConfigChecksum() const noexcept
+    {
+      return fConfigChecksum;
+    }
+
+    /// Returns the clocks data in the snapshot.
+    DetectorClocksData const&
+    ClocksData() const noexcept
+    {
+      return fClocksData;
+    }
+
+    /// Returns the conversion table between drift coordinate and ticks.
+    std::shared_ptr<XTicksTable const>
+    XTicks() const noexcept
+    {
+      return fXTicks;
+    }
+
+    /**
+     * @brief Returns the properties data in the snapshot.
+     * @param properties the provider the data refers to for the computations
+     * @throw std::runtime_error if the constants of `properties` differ from
+     *        the ones in the snapshot
+     *
+     * The conversion table is shared with this snapshot.
+     */
+    DetectorPropertiesData PropertiesData(DetectorProperties const& properties) const;
+
+    /**
+     * @brief Writes a snapshot into a file.
+     * @param fileName path of the snapshot file
+     * @param clockData the clocks data to be written
+     * @param propData the properties data to be written
+     * @param configChecksum checksum of the configuration the data is from
+     * @throw std::runtime_error if the file can't be written
+     */
+    static void Write(std::string const& fileName,
+                      DetectorClocksData const& clockData,
+                      DetectorPropertiesData const& propData,
+                      std::uint64_t configChecksum);
+
+    /// Returns the checksum of a configuration, e.g. `pset.to_string()`.
+    static std::uint64_t ConfigurationChecksum(std::string const& configuration) noexcept;
+
+  private:
+    /// Constant properties, as in `DetectorPropertiesData`.
+    struct Physics_t {
+      double xTicksCoefficient;
+      double efield;
+      double temperature;
+      double density;
+      double electronLifetime;
+      double electronsToADC;
+      double timeOffsetU;
+      double timeOffsetV;
+      double timeOffsetZ;
+      std::uint64_t hasTimeOffsetY;
+      double timeOffsetY; ///< Only meaningful if `hasTimeOffsetY` is set.
+      std::uint64_t numberTimeSamples;
+      std::uint64_t readOutWindowSize;
+      std::uint64_t simpleBoundary;
+    };
+
+    std::uint64_t fConfigChecksum;
+    DetectorClocksData fClocksData;
+    Physics_t fPhysics;
+    std::shared_ptr<XTicksTable const> fXTicks;
+
+    /// Constructor from decoded data.
+    DetectorInfoSnapshot(std::uint64_t configChecksum,
+                         DetectorClocksData const& clockData,
+                         Physics_t const& physics,
+                         std::shared_ptr<XTicksTable const> xTicks);
+
+    /// Decodes the content of a mapped file.
+    static DetectorInfoSnapshot decode(std::string const& fileName,
+                                       std::uint64_t const* words,
+                                       std::size_t nWords,
+                                       std::uint64_t configChecksum);
+
+  }; // class DetectorInfoSnapshot
+
+} // namespace detinfo
+
+#endif // LARDATAALG_DETECTORINFO_DETECTORINFOSNAPSHOT_H
@@ -11,6 +11,9 @@
 
 #include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
 
+#include <cstddef> // std::size_t
+#include <stdexcept> // std::runtime_error
+
 /// General LArSoft Utilities
 namespace detinfo {
 
@@ -53,6 +56,134 @@ namespace detinfo {
     virtual double ModBoxCorrection(double dQdX) const = 0;
     virtual double ModBoxCorrection(double dQdX, double EField) const = 0;
 
+    /**
+     * @brief Birks recombination correction for many dQ/dx values.
+     * @param dQdX pointer to the first of `n` values [electrons/cm]
+     * @param n number of values
+     * @param dEdX pointer to the first of `n` results [MeV/cm]
+     * @param EField electric field for all the values [kV/cm]
+     * @see BirksCorrection(double, double) const
+     *
+     * The output may be the same array as the input.
+     * The default implementation calls the single-value version for each
+     * value; implementations are encouraged to provide a faster one.
+     */
+    virtual void
+    BirksCorrection(double const* dQdX, std::size_t n, double* dEdX, double EField) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dEdX[i] = BirksCorrection(dQdX[i], EField);
+    }
+
+    /**
+     * @brief Birks recombination correction for many dQ/dx values and fields.
+     * @param dQdX pointer to the first of `n` values [electrons/cm]
+     * @param n number of values
+     * @param dEdX pointer to the first of `n` results [MeV/cm]
+     * @param EField pointer to the first of `n` local electric fields [kV/cm]
+     * @see BirksCorrection(double, double) const
+     */
+    virtual void
+    BirksCorrection(double const* dQdX, std::size_t n, double* dEdX, double const* EField) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dEdX[i] = BirksCorrection(dQdX[i], EField[i]);
+    }
+
+    /**
+     * @brief Modified box recombination correction for many dQ/dx values.
+     * @param dQdX pointer to the first of `n` values [electrons/cm]
+     * @param n number of values
+     * @param dEdX pointer to the first of `n` results [MeV/cm]
+     * @param EField electric field for all the values [kV/cm]
+     * @see ModBoxCorrection(double, double) const
+     */
+    virtual void
+    ModBoxCorrection(double const* dQdX, std::size_t n, double* dEdX, double EField) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dEdX[i] = ModBoxCorrection(dQdX[i], EField);
+    }
+
+    /**
+     * @brief Modified box recombination correction for many values and fields.
+     * @param dQdX pointer to the first of `n` values [electrons/cm]
+     * @param n number of values
+     * @param dEdX pointer to the first of `n` results [MeV/cm]
+     * @param EField pointer to the first of `n` local electric fields [kV/cm]
+     * @see ModBoxCorrection(double, double) const
+     */
+    virtual void
+    ModBoxCorrection(double const* dQdX, std::size_t n, double* dEdX, double const* EField) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dEdX[i] = ModBoxCorrection(dQdX[i], EField[i]);
+    }
+
+    /**
+     * @brief Inverse of the Birks correction: charge from energy loss.
+     * @param dEdX energy loss [MeV/cm]
+     * @param EField electric field [kV/cm]
+     * @return the collected charge [electrons/cm]
+     * @see BirksCorrection(double, double) const
+     */
+    virtual double
+    InverseBirksCorrection(double /* dEdX */, double /* EField */) const
+    {
+      throw std::runtime_error("DetectorProperties::InverseBirksCorrection() not implemented");
+    }
+
+    /// Inverse Birks correction for many values, all in the field `EField`.
+    virtual void
+    InverseBirksCorrection(double const* dEdX, std::size_t n, double* dQdX, double EField) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dQdX[i] = InverseBirksCorrection(dEdX[i], EField);
+    }
+
+    /// Inverse Birks correction for many values, each in its field from `EField`.
+    virtual void
+    InverseBirksCorrection(double const* dEdX,
+                           std::size_t n,
+                           double* dQdX,
+                           double const* EField) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dQdX[i] = InverseBirksCorrection(dEdX[i], EField[i]);
+    }
+
+    /**
+     * @brief Inverse of the modified box correction: charge from energy loss.
+     * @param dEdX energy loss [MeV/cm]
+     * @param EField electric field [kV/cm]
+     * @return the collected charge [electrons/cm]
+     * @see ModBoxCorrection(double, double) const
+     */
+    virtual double
+    InverseModBoxCorrection(double /* dEdX */, double /* EField */) const
+    {
+      throw std::runtime_error("DetectorProperties::InverseModBoxCorrection() not implemented");
+    }
+
+    /// Inverse modified box correction for many values, all in the field `EField`.
+    virtual void
+    InverseModBoxCorrection(double const* dEdX, std::size_t n, double* dQdX, double EField) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dQdX[i] = InverseModBoxCorrection(dEdX[i], EField);
+    }
+
+    /// Inverse modified box correction for many values, each in its field from `EField`.
+    virtual void
+    InverseModBoxCorrection(double const* dEdX,
+                            std::size_t n,
+                            double* dQdX,
+                            double const* EField) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dQdX[i] = InverseModBoxCorrection(dEdX[i], EField[i]);
+    }
+
     /**
      * @brief Returns the attenuation constant for ionization electrons.
      * @return the attenuation constant [&micro;s]
@@ -94,6 +225,40 @@ namespace detinfo {
      */
     virtual double ElossVar(double mom, double mass) const = 0;
 
+    /**
+     * @brief Restricted mean energy loss for many momenta of one particle.
+     * @param mom pointer to the first of `n` momenta [GeV/c]
+     * @param n number of momenta
+     * @param dEdx pointer to the first of `n` results [MeV/cm]
+     * @param mass mass of incident particle [GeV/c^2]
+     * @param tcut maximum kinetic energy of delta rays [MeV]; 0 for unlimited
+     * @see Eloss(double, double, double) const
+     *
+     * The default implementation calls the single-value version for each
+     * momentum; implementations are encouraged to provide a faster one.
+     */
+    virtual void
+    Eloss(double const* mom, std::size_t n, double* dEdx, double mass, double tcut) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dEdx[i] = Eloss(mom[i], mass, tcut);
+    }
+
+    /**
+     * @brief Energy loss fluctuation for many momenta of one particle.
+     * @param mom pointer to the first of `n` momenta [GeV/c]
+     * @param n number of momenta
+     * @param var pointer to the first of `n` results [MeV^2/cm]
+     * @param mass mass of incident particle [GeV/c^2]
+     * @see ElossVar(double, double) const
+     */
+    virtual void
+    ElossVar(double const* mom, std::size_t n, double* var, double mass) const
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        var[i] = ElossVar(mom[i], mass);
+    }
+
     /// Returns argon density at the temperature from Temperature()
     virtual double
     Density() const
@@ -1,5 +1,12 @@
 #include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
 #include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
+
+#include <cassert>
+#include <cmath> // std::exp()
+#include <stdexcept> // std::runtime_error
+#include <utility> // std::move()
 
 detinfo::DetectorPropertiesData::DetectorPropertiesData(
   DetectorProperties const& properties,
@@ -8,146 +15,304 @@ detinfo::DetectorPropertiesData::DetectorPropertiesData(
   std::vector<std::vector<double>>&& drift_direction)
 
   : fProperties{properties}
+  , fPhysics{takeSnapshot(properties)}
+  , fXTicksCoefficient{x_ticks_coefficient}
+  , fXTicks{
+      std::make_shared<XTicksTable const>(x_ticks_coefficient, x_ticks_offsets, drift_direction)}
+{}
+
+detinfo::DetectorPropertiesData::DetectorPropertiesData(DetectorProperties const& properties,
+                                                       double const x_ticks_coefficient,
+                                                       XTicksTable&& x_ticks_table)
+  : fProperties{properties}
+  , fPhysics{takeSnapshot(properties)}
   , fXTicksCoefficient{x_ticks_coefficient}
-  , fXTicksOffsets{move(x_ticks_offsets)}
-  , fDriftDirection{move(drift_direction)}
+  , fXTicks{std::make_shared<XTicksTable const>(std::move(x_ticks_table))}
 {}
 
+detinfo::DetectorPropertiesData::DetectorPropertiesData(
+  DetectorProperties const& properties,
+  double const x_ticks_coefficient,
+  std::shared_ptr<XTicksTable const> x_ticks_table)
+  : fProperties{properties}
+  , fPhysics{takeSnapshot(properties)}
+  , fXTicksCoefficient{x_ticks_coefficient}
+  , fXTicks{std::move(x_ticks_table)}
+{
+  assert(fXTicks);
+}
+
+detinfo::DetectorPropertiesData::PhysicsSnapshot_t
+detinfo::DetectorPropertiesData::takeSnapshot(DetectorProperties const& properties)
+{
+  return {properties.Efield(),
+          properties.Temperature(),
+          properties.Density(),
+          properties.ElectronLifetime(),
+          properties.ElectronsToADC(),
+          properties.NumberTimeSamples(),
+          properties.ReadOutWindowSize(),
+          properties.TimeOffsetU(),
+          properties.TimeOffsetV(),
+          properties.TimeOffsetZ(),
+          snapshotTimeOffsetY(properties),
+          properties.SimpleBoundary()};
+}
+
+std::optional<double>
+detinfo::DetectorPropertiesData::snapshotTimeOffsetY(DetectorProperties const& properties)
+{
+  // the base provider interface throws when the offset is not implemented
+  try {
+    return properties.TimeOffsetY();
+  }
+  catch (std::runtime_error const&) {
+    return std::nullopt;
+  }
+}
+
+bool
+detinfo::DetectorPropertiesData::SnapshotIsCurrent() const
+{
+  for (Quantity const quantity : {Quantity::efield,
+                                  Quantity::temperature,
+                                  Quantity::density,
+                                  Quantity::electronLifetime,
+                                  Quantity::electronsToADC,
+                                  Quantity::readOutWindowSize,
+                                  Quantity::timeOffsetU,
+                                  Quantity::timeOffsetV,
+                                  Quantity::timeOffsetZ,
+                                  Quantity::timeOffsetY,
+                                  Quantity::simpleBoundary}) {
+    if (!isCurrent(quantity)) return false;
+  }
+  return true;
+}
+
+bool
+detinfo::DetectorPropertiesData::isCurrent(Quantity const quantity) const
+{
+  switch (quantity) {
+  case Quantity::efield: return fProperties.Efield() == fPhysics.efield;
+  case Quantity::temperature: return fProperties.Temperature() == fPhysics.temperature;
+  case Quantity::density: return fProperties.Density() == fPhysics.density;
+  case Quantity::electronLifetime:
+    return fProperties.ElectronLifetime() == fPhysics.electronLifetime;
+  case Quantity::electronsToADC: return fProperties.ElectronsToADC() == fPhysics.electronsToADC;
+  case Quantity::readOutWindowSize:
+    return fProperties.ReadOutWindowSize() == fPhysics.readOutWindowSize;
+  case Quantity::timeOffsetU: return fProperties.TimeOffsetU() == fPhysics.timeOffsetU;
+  case Quantity::timeOffsetV: return fProperties.TimeOffsetV() == fPhysics.timeOffsetV;
+  case Quantity::timeOffsetZ: return fProperties.TimeOffsetZ() == fPhysics.timeOffsetZ;
+  case Quantity::timeOffsetY:
+    // an offset the provider does not implement was not copied: nothing to check
+    return !fPhysics.timeOffsetY || (fProperties.TimeOffsetY() == *fPhysics.timeOffsetY);
+  case Quantity::simpleBoundary: return fProperties.SimpleBoundary() == fPhysics.simpleBoundary;
+  } // switch
+  return false;
+}
+
 double
-detinfo::DetectorPropertiesData::Efield(unsigned int const planegap) const
+detinfo::DetectorPropertiesData::providerEfield(unsigned int const planegap) const
 {
   return fProperties.Efield(planegap);
 }
 
 double
-detinfo::DetectorPropertiesData::DriftVelocity(double const efield, double const temperature) const
+detinfo::DetectorPropertiesData::providerDensity(double const temperature) const
 {
-  return fProperties.DriftVelocity(efield, temperature);
+  return fProperties.Density(temperature);
 }
 
 double
-detinfo::DetectorPropertiesData::BirksCorrection(double const dQdX) const
+detinfo::DetectorPropertiesData::providerTimeOffsetY() const
 {
-  return fProperties.BirksCorrection(dQdX, Efield());
+  return fProperties.TimeOffsetY();
 }
+
 double
-detinfo::DetectorPropertiesData::BirksCorrection(double const dQdX, double const EField) const
+detinfo::DetectorPropertiesData::DriftVelocity(double const efield, double const temperature) const
 {
-  return fProperties.BirksCorrection(dQdX, EField);
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::DriftVelocity");
+  return fProperties.DriftVelocity(efield, temperature);
 }
 
 double
-detinfo::DetectorPropertiesData::ModBoxCorrection(double const dQdX) const
+detinfo::DetectorPropertiesData::BirksCorrection(double const dQdX, double const EField) const
 {
-  return fProperties.ModBoxCorrection(dQdX, Efield());
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::BirksCorrection");
+  return fProperties.BirksCorrection(dQdX, EField);
 }
+
 double
 detinfo::DetectorPropertiesData::ModBoxCorrection(double const dQdX, double const EField) const
 {
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::ModBoxCorrection");
   return fProperties.ModBoxCorrection(dQdX, EField);
 }
 
-double
-detinfo::DetectorPropertiesData::ElectronsToADC() const
+void
+detinfo::DetectorPropertiesData::BirksCorrection(double const* dQdX,
+                                                 std::size_t const n,
+                                                 double* dEdX,
+                                                 double const EField) const
 {
-  return fProperties.ElectronsToADC();
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::BirksCorrection[batch]");
+  fProperties.BirksCorrection(dQdX, n, dEdX, EField);
 }
 
-unsigned int
-detinfo::DetectorPropertiesData::NumberTimeSamples() const
+void
+detinfo::DetectorPropertiesData::BirksCorrection(double const* dQdX,
+                                                 std::size_t const n,
+                                                 double* dEdX,
+                                                 double const* EField) const
 {
-  return fProperties.NumberTimeSamples();
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::BirksCorrection[batch, fields]");
+  fProperties.BirksCorrection(dQdX, n, dEdX, EField);
 }
 
-unsigned int
-detinfo::DetectorPropertiesData::ReadOutWindowSize() const
+void
+detinfo::DetectorPropertiesData::ModBoxCorrection(double const* dQdX,
+                                                  std::size_t const n,
+                                                  double* dEdX,
+                                                  double const EField) const
 {
-  return fProperties.ReadOutWindowSize();
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::ModBoxCorrection[batch]");
+  fProperties.ModBoxCorrection(dQdX, n, dEdX, EField);
 }
 
-double
-detinfo::DetectorPropertiesData::ElectronLifetime() const
+void
+detinfo::DetectorPropertiesData::ModBoxCorrection(double const* dQdX,
+                                                  std::size_t const n,
+                                                  double* dEdX,
+                                                  double const* EField) const
 {
-  return fProperties.ElectronLifetime();
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::ModBoxCorrection[batch, fields]");
+  fProperties.ModBoxCorrection(dQdX, n, dEdX, EField);
 }
 
 double
-detinfo::DetectorPropertiesData::Density(double const temperature) const
+detinfo::DetectorPropertiesData::InverseBirksCorrection(double const dEdX,
+                                                        double const EField) const
 {
-  return fProperties.Density(temperature);
+  return fProperties.InverseBirksCorrection(dEdX, EField);
 }
 
-double
-detinfo::DetectorPropertiesData::Temperature() const
+void
+detinfo::DetectorPropertiesData::InverseBirksCorrection(double const* dEdX,
+                                                        std::size_t const n,
+                                                        double* dQdX,
+                                                        double const EField) const
 {
-  return fProperties.Temperature();
+  fProperties.InverseBirksCorrection(dEdX, n, dQdX, EField);
 }
 
-double
-detinfo::DetectorPropertiesData::Eloss(double const mom, double const mass, double const tcut) const
+void
+detinfo::DetectorPropertiesData::InverseBirksCorrection(double const* dEdX,
+                                                        std::size_t const n,
+                                                        double* dQdX,
+                                                        double const* EField) const
 {
-  return fProperties.Eloss(mom, mass, tcut);
+  fProperties.InverseBirksCorrection(dEdX, n, dQdX, EField);
 }
 
 double
-detinfo::DetectorPropertiesData::ElossVar(double const mom, double const mass) const
+detinfo::DetectorPropertiesData::InverseModBoxCorrection(double const dEdX,
+                                                         double const EField) const
 {
-  return fProperties.ElossVar(mom, mass);
+  return fProperties.InverseModBoxCorrection(dEdX, EField);
 }
 
-double
-detinfo::DetectorPropertiesData::ConvertXToTicks(double const X,
-                                                 int const p,
-                                                 int const t,
-                                                 int const c) const
+void
+detinfo::DetectorPropertiesData::InverseModBoxCorrection(double const* dEdX,
+                                                         std::size_t const n,
+                                                         double* dQdX,
+                                                         double const EField) const
 {
-  return (X / (fXTicksCoefficient * fDriftDirection.at(c).at(t)) +
-          fXTicksOffsets.at(c).at(t).at(p));
+  fProperties.InverseModBoxCorrection(dEdX, n, dQdX, EField);
 }
 
-double
-detinfo::DetectorPropertiesData::ConvertXToTicks(double const X, geo::PlaneID const& planeid) const
+void
+detinfo::DetectorPropertiesData::InverseModBoxCorrection(double const* dEdX,
+                                                         std::size_t const n,
+                                                         double* dQdX,
+                                                         double const* EField) const
 {
-  return ConvertXToTicks(X, planeid.Plane, planeid.TPC, planeid.Cryostat);
+  fProperties.InverseModBoxCorrection(dEdX, n, dQdX, EField);
 }
 
 double
-detinfo::DetectorPropertiesData::ConvertTicksToX(double const ticks,
-                                                 int const p,
-                                                 int const t,
-                                                 int const c) const
+detinfo::DetectorPropertiesData::LifetimeCorrection(double const tick,
+                                                    DetectorClocksData const& clock_data,
+                                                    double const T0) const
 {
-  return (ticks - fXTicksOffsets.at(c).at(t).at(p)) * fXTicksCoefficient *
-         fDriftDirection.at(c).at(t);
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::LifetimeCorrection");
+  double corrected;
+  double const charge = 1.0;
+  LifetimeCorrection(&tick, &charge, 1U, &corrected, clock_data, T0);
+  return corrected;
 }
 
-double
-detinfo::DetectorPropertiesData::ConvertTicksToX(double const ticks,
-                                                 geo::PlaneID const& planeid) const
+void
+detinfo::DetectorPropertiesData::LifetimeCorrection(double const* ticks,
+                                                    double const* charges,
+                                                    std::size_t const n,
+                                                    double* corrected,
+                                                    DetectorClocksData const& clock_data,
+                                                    double const T0) const
 {
-  return ConvertTicksToX(ticks, planeid.Plane, planeid.TPC, planeid.Cryostat);
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::LifetimeCorrection[batch]");
+  // drift time [us] is (tick - trigger offset) * period - T0:
+  // the exponent is then tick * slope - shift
+  double const tickPeriod = sampling_rate(clock_data) * 1.e-3; // us
+  double const slope = tickPeriod / ElectronLifetime();
+  double const shift = trigger_offset(clock_data) * slope + T0 * 1.e-3 / ElectronLifetime();
+
+  for (std::size_t i = 0; i < n; ++i)
+    corrected[i] = charges[i] * std::exp(ticks[i] * slope - shift);
 }
 
 double
-detinfo::DetectorPropertiesData::TimeOffsetU() const
+detinfo::DetectorPropertiesData::Eloss(double const mom, double const mass, double const tcut) const
 {
-  return fProperties.TimeOffsetU();
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::Eloss");
+  return fProperties.Eloss(mom, mass, tcut);
 }
+
 double
-detinfo::DetectorPropertiesData::TimeOffsetV() const
+detinfo::DetectorPropertiesData::ElossVar(double const mom, double const mass) const
 {
-  return fProperties.TimeOffsetV();
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::ElossVar");
+  return fProperties.ElossVar(mom, mass);
 }
-double
-detinfo::DetectorPropertiesData::TimeOffsetZ() const
+
+void
+detinfo::DetectorPropertiesData::Eloss(double const* mom,
+                                       std::size_t const n,
+                                       double* dEdx,
+                                       double const mass,
+                                       double const tcut) const
 {
-  return fProperties.TimeOffsetZ();
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::Eloss[batch]");
+  fProperties.Eloss(mom, n, dEdx, mass, tcut);
+}
+
+void
+detinfo::DetectorPropertiesData::ElossVar(double const* mom,
+                                          std::size_t const n,
+                                          double* var,
+                                          double const mass) const
+{
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::ElossVar[batch]");
+  fProperties.ElossVar(mom, n, var, mass);
 }
 
 double
 detinfo::DetectorPropertiesData::GetXTicksOffset(int const p, int const t, int const c) const
 {
-  return fXTicksOffsets.at(c).at(t).at(p);
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::GetXTicksOffset");
+  return fXTicks->OffsetAt(p, t, c);
 }
 
 double
@@ -159,17 +324,19 @@ detinfo::DetectorPropertiesData::GetXTicksOffset(geo::PlaneID const& planeid) co
 double
 detinfo::DetectorPropertiesData::GetXTicksCoefficient(int const t, int const c) const
 {
-  return fXTicksCoefficient * fDriftDirection.at(c).at(t);
+  DETINFO_INSTRUMENTED_CALL("DetectorPropertiesData::GetXTicksCoefficient");
+  return fXTicks->CoefficientAt(t, c);
 }
 
 double
-detinfo::DetectorPropertiesData::GetXTicksCoefficient() const
+detinfo::DetectorPropertiesData::GetXTicksCoefficient(geo::TPCID const& tpcid) const
 {
-  return fXTicksCoefficient;
+  return GetXTicksCoefficient(tpcid.TPC, tpcid.Cryostat);
 }
 
-bool
-detinfo::DetectorPropertiesData::SimpleBoundary() const
+double
+detinfo::DetectorPropertiesData::GetXTicksCoefficient() const
 {
-  return fProperties.SimpleBoundary();
+  return fXTicksCoefficient;
 }
+
@@ -1,11 +1,18 @@
 #ifndef DETINFO_DETECTORPROPERTIESDATA_H
 #define DETINFO_DETECTORPROPERTIESDATA_H
 
+#include "lardataalg/DetectorInfo/XTicksTable.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <memory>  // std::shared_ptr
+#include <optional>
+#include <utility> // std::pair
 #include <vector>
 
 namespace detinfo {
+  class DetectorClocksData;
   class DetectorProperties;
 
   class DetectorPropertiesData {
@@ -15,18 +22,178 @@ namespace detinfo {
                                     std::vector<std::vector<std::vector<double>>>&& x_ticks_offsets,
                                     std::vector<std::vector<double>>&& drift_direction);
 
-    double Efield(unsigned int planegap = 0) const; ///< kV/cm
+    /**
+     * @brief Constructor from an already packed conversion table.
+     * @param properties the provider this data is derived from
+     * @param x_ticks_coefficient drift coordinate per tick [cm], unsigned
+     * @param x_ticks_table complete conversion parameters for all planes
+     */
+    explicit DetectorPropertiesData(DetectorProperties const& properties,
+                                    double x_ticks_coefficient,
+                                    XTicksTable&& x_ticks_table);
+
+    /**
+     * @brief Constructor sharing an existing conversion table.
+     * @param properties the provider this data is derived from
+     * @param x_ticks_coefficient drift coordinate per tick [cm], unsigned
+     * @param x_ticks_table complete conversion parameters for all planes
+     *
+     * The table is shared, not copied: copies of this object are also cheap,
+     * since they share the same table.
+     */
+    explicit DetectorPropertiesData(DetectorProperties const& properties,
+                                    double x_ticks_coefficient,
+                                    std::shared_ptr<XTicksTable const> x_ticks_table);
+
+    /// Electric field in the specified plane gap [kV/cm] (main one by default).
+    double
+    Efield(unsigned int const planegap = 0) const
+    {
+      assert(isCurrent(Quantity::efield));
+      return (planegap == 0) ? fPhysics.efield : providerEfield(planegap);
+    }
 
     double DriftVelocity(double efield = 0.,
                          double temperature = 0.) const; ///< cm/us
 
     /// dQ/dX in electrons/cm, returns dE/dX in MeV/cm.
-    double BirksCorrection(double dQdX) const;
+    double
+    BirksCorrection(double const dQdX) const
+    {
+      return BirksCorrection(dQdX, Efield());
+    }
     double BirksCorrection(double dQdX, double EField) const;
-    double ModBoxCorrection(double dQdX) const;
+    double
+    ModBoxCorrection(double const dQdX) const
+    {
+      return ModBoxCorrection(dQdX, Efield());
+    }
     double ModBoxCorrection(double dQdX, double EField) const;
 
-    double ElectronLifetime() const;
+    /**
+     * @brief Birks recombination correction for many dQ/dx values.
+     * @param dQdX pointer to the first of `n` values [electrons/cm]
+     * @param n number of values
+     * @param dEdX pointer to the first of `n` results [MeV/cm]
+     *
+     * The main electric field is used. The output may be the same array as
+     * the input.
+     */
+    void
+    BirksCorrection(double const* dQdX, std::size_t const n, double* dEdX) const
+    {
+      BirksCorrection(dQdX, n, dEdX, Efield());
+    }
+
+    /// Birks correction for many dQ/dx values, all in the field `EField` [kV/cm].
+    void BirksCorrection(double const* dQdX, std::size_t n, double* dEdX, double EField) const;
+
+    /// Birks correction for many dQ/dx values, each in its field from `EField` [kV/cm].
+    void BirksCorrection(double const* dQdX,
+                         std::size_t n,
+                         double* dEdX,
+                         double const* EField) const;
+
+    /// Modified box correction for many dQ/dx values, in the main field.
+    void
+    ModBoxCorrection(double const* dQdX, std::size_t const n, double* dEdX) const
+    {
+      ModBoxCorrection(dQdX, n, dEdX, Efield());
+    }
+
+    /// Modified box correction for many dQ/dx values, all in the field `EField` [kV/cm].
+    void ModBoxCorrection(double const* dQdX, std::size_t n, double* dEdX, double EField) const;
+
+    /// Modified box correction for many dQ/dx values, each in its field from `EField` [kV/cm].
+    void ModBoxCorrection(double const* dQdX,
+                          std::size_t n,
+                          double* dEdX,
+                          double const* EField) const;
+
+    /// dE/dX in MeV/cm, returns dQ/dX in electrons/cm (inverse of `BirksCorrection()`).
+    double
+    InverseBirksCorrection(double const dEdX) const
+    {
+      return InverseBirksCorrection(dEdX, Efield());
+    }
+    double InverseBirksCorrection(double dEdX, double EField) const;
+    void
+    InverseBirksCorrection(double const* dEdX, std::size_t const n, double* dQdX) const
+    {
+      InverseBirksCorrection(dEdX, n, dQdX, Efield());
+    }
+    void InverseBirksCorrection(double const* dEdX,
+                                std::size_t n,
+                                double* dQdX,
+                                double EField) const;
+    void InverseBirksCorrection(double const* dEdX,
+                                std::size_t n,
+                                double* dQdX,
+                                double const* EField) const;
+
+    /// dE/dX in MeV/cm, returns dQ/dX in electrons/cm (inverse of `ModBoxCorrection()`).
+    double
+    InverseModBoxCorrection(double const dEdX) const
+    {
+      return InverseModBoxCorrection(dEdX, Efield());
+    }
+    double InverseModBoxCorrection(double dEdX, double EField) const;
+    void
+    InverseModBoxCorrection(double const* dEdX, std::size_t const n, double* dQdX) const
+    {
+      InverseModBoxCorrection(dEdX, n, dQdX, Efield());
+    }
+    void InverseModBoxCorrection(double const* dEdX,
+                                 std::size_t n,
+                                 double* dQdX,
+                                 double EField) const;
+    void InverseModBoxCorrection(double const* dEdX,
+                                 std::size_t n,
+                                 double* dQdX,
+                                 double const* EField) const;
+
+    double
+    ElectronLifetime() const
+    {
+      assert(isCurrent(Quantity::electronLifetime));
+      return fPhysics.electronLifetime;
+    }
+
+    /**
+     * @brief Returns the factor correcting the charge of a hit for attenuation.
+     * @param tick time of the hit [TPC ticks]
+     * @param clock_data clock settings the tick refers to
+     * @param T0 time of the interaction, relative to the trigger [ns]
+     * @return the factor to multiply the charge of the hit by
+     *
+     * The drift time is the time of the hit from the trigger, as measured by
+     * the TPC clock, minus `T0`; the correction is
+     * @f$ e^{t_{\mathrm{drift}}/\tau} @f$, with @f$ \tau @f$ the
+     * `ElectronLifetime()`.
+     */
+    double LifetimeCorrection(double tick,
+                              DetectorClocksData const& clock_data,
+                              double T0 = 0.) const;
+
+    /**
+     * @brief Corrects the charge of many hits for the attenuation.
+     * @param ticks pointer to the first of `n` hit times [TPC ticks]
+     * @param charges pointer to the first of `n` hit charges
+     * @param n number of hits
+     * @param corrected pointer to the first of the `n` corrected charges
+     * @param clock_data clock settings the ticks refer to
+     * @param T0 time of the interaction, relative to the trigger [ns]
+     * @see LifetimeCorrection(double, DetectorClocksData const&, double) const
+     *
+     * Clock parameters and lifetime are read once for all the hits.
+     * The output may be the same array as the charge input.
+     */
+    void LifetimeCorrection(double const* ticks,
+                            double const* charges,
+                            std::size_t n,
+                            double* corrected,
+                            DetectorClocksData const& clock_data,
+                            double T0 = 0.) const;
 
     /**
      * @brief Returns argon density at a given temperature
@@ -38,10 +205,20 @@ namespace detinfo {
      * Slope is between -6.2 and -6.1, intercept is 1928 kg/m^3.
      * This parameterization will be good to better than 0.5%.
      */
-    double Density(double temperature = 0.) const; ///< g/cm^3
+    double
+    Density(double const temperature = 0.) const ///< g/cm^3
+    {
+      assert(isCurrent(Quantity::density));
+      return (temperature == 0.) ? fPhysics.density : providerDensity(temperature);
+    }
 
     /// In kelvin.
-    double Temperature() const;
+    double
+    Temperature() const
+    {
+      assert(isCurrent(Quantity::temperature));
+      return fPhysics.temperature;
+    }
 
     /**
      * @brief Restricted mean energy loss (dE/dx)
@@ -69,19 +246,163 @@ namespace detinfo {
      */
     double ElossVar(double mom, double mass) const;
 
-    double ElectronsToADC() const;
-    unsigned int NumberTimeSamples() const;
-    unsigned int ReadOutWindowSize() const;
-    double TimeOffsetU() const;
-    double TimeOffsetV() const;
-    double TimeOffsetZ() const;
-    double TimeOffsetY() const;
+    /**
+     * @brief Restricted mean energy loss for many momenta of one particle.
+     * @param mom pointer to the first of `n` momenta [GeV/c]
+     * @param n number of momenta
+     * @param dEdx pointer to the first of `n` results [MeV/cm]
+     * @param mass mass of incident particle [GeV/c^2]
+     * @param tcut maximum kinetic energy of delta rays [MeV]; 0 for unlimited
+     */
+    void Eloss(double const* mom, std::size_t n, double* dEdx, double mass, double tcut) const;
 
-    double ConvertXToTicks(double X, int p, int t, int c) const;
-    double ConvertXToTicks(double X, geo::PlaneID const& planeid) const;
+    /**
+     * @brief Energy loss fluctuation for many momenta of one particle.
+     * @param mom pointer to the first of `n` momenta [GeV/c]
+     * @param n number of momenta
+     * @param var pointer to the first of `n` results [MeV^2/cm]
+     * @param mass mass of incident particle [GeV/c^2]
+     */
+    void ElossVar(double const* mom, std::size_t n, double* var, double mass) const;
+
+    double
+    ElectronsToADC() const
+    {
+      assert(isCurrent(Quantity::electronsToADC));
+      return fPhysics.electronsToADC;
+    }
+    unsigned int
+    NumberTimeSamples() const
+    {
+      return fPhysics.numberTimeSamples;
+    }
+    unsigned int
+    ReadOutWindowSize() const
+    {
+      assert(isCurrent(Quantity::readOutWindowSize));
+      return fPhysics.readOutWindowSize;
+    }
+    double
+    TimeOffsetU() const
+    {
+      assert(isCurrent(Quantity::timeOffsetU));
+      return fPhysics.timeOffsetU;
+    }
+    double
+    TimeOffsetV() const
+    {
+      assert(isCurrent(Quantity::timeOffsetV));
+      return fPhysics.timeOffsetV;
+    }
+    double
+    TimeOffsetZ() const
+    {
+      assert(isCurrent(Quantity::timeOffsetZ));
+      return fPhysics.timeOffsetZ;
+    }
+    /// Time offset of view Y [ticks]; the provider may not implement it.
+    double
+    TimeOffsetY() const
+    {
+      assert(isCurrent(Quantity::timeOffsetY));
+      return fPhysics.timeOffsetY ? *fPhysics.timeOffsetY : providerTimeOffsetY();
+    }
+    /// Returns whether the provider implements the time offset of view Y.
+    bool
+    HasTimeOffsetY() const
+    {
+      return fPhysics.timeOffsetY.has_value();
+    }
+
+    /**
+     * @brief Converts a drift coordinate into a tick on the specified plane.
+     *
+     * The plane is not checked to exist except in debug builds: use
+     * `GetXTicksOffset()` for a checked access.
+     */
+    double
+    ConvertXToTicks(double const X, int const p, int const t, int const c) const
+    {
+      return fXTicks->XToTicks(X, p, t, c);
+    }
+    double
+    ConvertXToTicks(double const X, geo::PlaneID const& planeid) const
+    {
+      return fXTicks->XToTicks(X, planeid.Plane, planeid.TPC, planeid.Cryostat);
+    }
+
+    /**
+     * @brief Converts a tick on the specified plane into a drift coordinate.
+     *
+     * The plane is not checked to exist except in debug builds.
+     */
+    double
+    ConvertTicksToX(double const ticks, int const p, int const t, int const c) const
+    {
+      return fXTicks->TicksToX(ticks, p, t, c);
+    }
+    double
+    ConvertTicksToX(double const ticks, geo::PlaneID const& planeid) const
+    {
+      return fXTicks->TicksToX(ticks, planeid.Plane, planeid.TPC, planeid.Cryostat);
+    }
+
+    /**
+     * @brief Converts drift coordinates into ticks on the specified plane.
+     * @param X pointer to the first of `n` coordinates to convert [cm]
+     * @param n number of coordinates to convert
+     * @param ticks pointer to the first of the `n` converted values
+     * @param planeid plane all the coordinates are converted for
+     *
+     * The output may be the same array as the input.
+     */
+    void
+    ConvertXToTicks(double const* X,
+                    std::size_t const n,
+                    double* ticks,
+                    geo::PlaneID const& planeid) const noexcept
+    {
+      fXTicks->XToTicks(X, n, ticks, planeid.Plane, planeid.TPC, planeid.Cryostat);
+    }
+
+    /**
+     * @brief Converts ticks on the specified plane into drift coordinates.
+     * @param ticks pointer to the first of `n` ticks to convert
+     * @param n number of ticks to convert
+     * @param X pointer to the first of the `n` converted values [cm]
+     * @param planeid plane all the ticks are converted for
+     *
+     * The output may be the same array as the input.
+     */
+    void
+    ConvertTicksToX(double const* ticks,
+                    std::size_t const n,
+                    double* X,
+                    geo::PlaneID const& planeid) const noexcept
+    {
+      fXTicks->TicksToX(ticks, n, X, planeid.Plane, planeid.TPC, planeid.Cryostat);
+    }
+
+    /**
+     * @brief Converts ticks, each on its own plane, into drift coordinates.
+     * @param hits pointer to the first of `n` (tick, plane) pairs to convert
+     * @param n number of ticks to convert
+     * @param X pointer to the first of the `n` converted values [cm]
+     */
+    void
+    ConvertTicksToX(std::pair<double, geo::PlaneID> const* hits,
+                    std::size_t const n,
+                    double* X) const noexcept
+    {
+      fXTicks->TicksToX(hits, n, X);
+    }
 
-    double ConvertTicksToX(double ticks, int p, int t, int c) const;
-    double ConvertTicksToX(double ticks, geo::PlaneID const& planeid) const;
+    /// Returns the packed table of x/ticks conversion parameters.
+    XTicksTable const&
+    XTicks() const noexcept
+    {
+      return *fXTicks;
+    }
 
     double GetXTicksOffset(int p, int t, int c) const;
     double GetXTicksOffset(geo::PlaneID const& planeid) const;
@@ -90,13 +411,84 @@ namespace detinfo {
     double GetXTicksCoefficient(geo::TPCID const& tpcid) const;
     double GetXTicksCoefficient() const;
 
-    bool SimpleBoundary() const;
+    bool
+    SimpleBoundary() const
+    {
+      assert(isCurrent(Quantity::simpleBoundary));
+      return fPhysics.simpleBoundary;
+    }
+
+    /**
+     * @brief Returns whether the values copied from the provider are current.
+     *
+     * The constant physics quantities are copied from the provider when this
+     * object is created, so that their accessors need no call to the
+     * provider. In debug builds, each accessor checks that the copy of its
+     * own quantity still matches the provider; this method checks all of
+     * them. The number of time samples is not checked, since the provider
+     * may change it after this object is created
+     * (e.g. `DetectorPropertiesStandard::SetNumberTimeSamples()`), and
+     * neither is the time offset of view Y when the provider does not
+     * implement it.
+     */
+    bool SnapshotIsCurrent() const;
 
   private:
+    /// Constant values copied from the provider.
+    struct PhysicsSnapshot_t {
+      double efield;                  ///< Main electric field [kV/cm].
+      double temperature;             ///< Argon temperature [K].
+      double density;                 ///< Argon density at `temperature` [g/cm^3].
+      double electronLifetime;        ///< Electron lifetime [us].
+      double electronsToADC;          ///< ADC counts per ionization electron.
+      unsigned int numberTimeSamples; ///< Ticks per event.
+      unsigned int readOutWindowSize; ///< Ticks per readout window.
+      double timeOffsetU;             ///< Time offset of view U [ticks].
+      double timeOffsetV;             ///< Time offset of view V [ticks].
+      double timeOffsetZ;             ///< Time offset of view Z [ticks].
+      /// Time offset of view Y [ticks], if the provider implements it.
+      std::optional<double> timeOffsetY;
+      bool simpleBoundary;            ///< Whether to use the simple boundary process.
+    };
+
+    /// Quantities in the snapshot which are checked against the provider.
+    enum class Quantity {
+      efield,
+      temperature,
+      density,
+      electronLifetime,
+      electronsToADC,
+      readOutWindowSize,
+      timeOffsetU,
+      timeOffsetV,
+      timeOffsetZ,
+      timeOffsetY,
+      simpleBoundary
+    };
+
+    /// Returns whether the copy of `quantity` still matches the provider.
+    bool isCurrent(Quantity quantity) const;
+
+    /// Copies the constant values from the provider.
+    static PhysicsSnapshot_t takeSnapshot(DetectorProperties const& properties);
+
+    /// Returns the time offset of view Y from the provider, if implemented.
+    static std::optional<double> snapshotTimeOffsetY(DetectorProperties const& properties);
+
+    /// Returns the electric field in a plane gap from the provider.
+    double providerEfield(unsigned int planegap) const;
+
+    /// Returns the density at a temperature from the provider.
+    double providerDensity(double temperature) const;
+
+    /// Returns the time offset of view Y from the provider (which may throw).
+    double providerTimeOffsetY() const;
+
     detinfo::DetectorProperties const& fProperties;
+    PhysicsSnapshot_t const fPhysics; ///< Values copied from `fProperties`.
     double const fXTicksCoefficient;
-    std::vector<std::vector<std::vector<double>>> const fXTicksOffsets;
-    std::vector<std::vector<double>> const fDriftDirection;
+    /// Per-plane x/ticks conversion parameters (shared among copies).
+    std::shared_ptr<XTicksTable const> const fXTicks;
   }; // class DetectorPropertiesStandard
 } // namespace detinfo
 
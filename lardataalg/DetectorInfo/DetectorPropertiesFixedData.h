@@ -0,0 +1,138 @@
+/**
+ * @file   lardataalg/DetectorInfo/DetectorPropertiesFixedData.h
+ * @brief  Detector properties with conversions for a layout known at compile time.
+ * @see    lardataalg/DetectorInfo/FixedXTicksTable.h
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_DETECTORPROPERTIESFIXEDDATA_H
+#define LARDATAALG_DETECTORINFO_DETECTORPROPERTIESFIXEDDATA_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/FixedXTicksTable.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <utility> // std::pair
+
+namespace detinfo {
+
+  /**
+   * @brief `DetectorPropertiesData` specialized for a fixed detector layout.
+   * @tparam MaxPlanes maximum number of planes in a TPC
+   * @tparam MaxTPCs maximum number of TPCs in a cryostat
+   * @tparam MaxCryostats maximum number of cryostats
+   *
+   * This object is built from the generic data returned by
+   * `DetectorProperties::DataFor()`, and offers the drift coordinate/tick
+   * conversions using a `FixedXTicksTable` copy of the conversion parameters
+   * instead of the generic table: they return the same values, with strides
+   * known at compile time. The rest of the interface is in the generic data,
+   * available via `Data()`.
+   *
+   * This object is not a `DetectorPropertiesData`: since the conversions of
+   * the latter are not virtual, an algorithm taking the generic data would
+   * silently use the generic conversions anyway. To use the fixed ones,
+   * an algorithm needs to take this object (e.g. as a template parameter).
+   *
+   * Example for a detector with 3 planes in each of its 4 TPCs:
+   *
+   *     detinfo::DetectorPropertiesFixedData<3, 4> const detProp{
+   *       detPropProvider.DataFor(clockData)
+   *       };
+   *     double const x = detProp.ConvertTicksToX(hit.PeakTime(), hit.WireID());
+   *     double const lifetime = detProp.Data().ElectronLifetime();
+   *
+   */
+  template <unsigned int MaxPlanes, unsigned int MaxTPCs, unsigned int MaxCryostats = 1U>
+  class DetectorPropertiesFixedData {
+  public:
+    /// Type of the conversion parameter table.
+    using XTicksTable_t = FixedXTicksTable<MaxPlanes, MaxTPCs, MaxCryostats>;
+
+    /**
+     * @brief Builds the data from the generic one.
+     * @param data the generic data
+     * @throw std::length_error if the detector does not fit the layout
+     */
+    explicit DetectorPropertiesFixedData(DetectorPropertiesData const& data)
+      : fData{data}, fFixedXTicks{data.XTicks()}
+    {}
+
+    /// Returns the generic data this object was built from.
+    DetectorPropertiesData const&
+    Data() const noexcept
+    {
+      return fData;
+    }
+
+    double
+    ConvertXToTicks(double const X, int const p, int const t, int const c) const
+    {
+      return fFixedXTicks.XToTicks(X, p, t, c);
+    }
+    double
+    ConvertXToTicks(double const X, geo::PlaneID const& planeid) const
+    {
+      return fFixedXTicks.XToTicks(X, planeid.Plane, planeid.TPC, planeid.Cryostat);
+    }
+
+    double
+    ConvertTicksToX(double const ticks, int const p, int const t, int const c) const
+    {
+      return fFixedXTicks.TicksToX(ticks, p, t, c);
+    }
+    double
+    ConvertTicksToX(double const ticks, geo::PlaneID const& planeid) const
+    {
+      return fFixedXTicks.TicksToX(ticks, planeid.Plane, planeid.TPC, planeid.Cryostat);
+    }
+
+    void
+    ConvertXToTicks(double const* X,
+                    std::size_t const n,
+                    double* ticks,
+                    geo::PlaneID const& planeid) const noexcept
+    {
+      fFixedXTicks.XToTicks(X, n, ticks, planeid.Plane, planeid.TPC, planeid.Cryostat);
+    }
+
+    void
+    ConvertTicksToX(double const* ticks,
+                    std::size_t const n,
+                    double* X,
+                    geo::PlaneID const& planeid) const noexcept
+    {
+      fFixedXTicks.TicksToX(ticks, n, X, planeid.Plane, planeid.TPC, planeid.Cryostat);
+    }
+
+    void
+    ConvertTicksToX(std::pair<double, geo::PlaneID> const* hits,
+                    std::size_t const n,
+                    double* X) const noexcept
+    {
+      for (std::size_t i = 0; i < n; ++i) {
+        geo::PlaneID const& planeid = hits[i].second;
+        X[i] = fFixedXTicks.TicksToX(hits[i].first, planeid.Plane, planeid.TPC, planeid.Cryostat);
+      }
+    }
+
+    /// Returns the fixed size table of conversion parameters.
+    XTicksTable_t const&
+    FixedXTicks() const noexcept
+    {
+      return fFixedXTicks;
+    }
+
+  private:
+    DetectorPropertiesData fData; ///< The generic data.
+    XTicksTable_t fFixedXTicks;   ///< Conversion parameters.
+
+  }; // class DetectorPropertiesFixedData
+
+} // namespace detinfo
+
+#endif // LARDATAALG_DETECTORINFO_DETECTORPROPERTIESFIXEDDATA_H
@@ -8,6 +8,8 @@
 
 // LArSoft includes
 #include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
+#include "lardataalg/DetectorInfo/RecombinationModels.h"
 #include "larcorealg/CoreUtils/ProviderUtil.h" // lar::IgnorableProviderConfigKeys()
 #include "larcorealg/Geometry/CryostatGeo.h"
 #include "larcorealg/Geometry/GeometryCore.h"
@@ -22,7 +24,74 @@
 #include "fhiclcpp/types/Table.h"
 
 // C/C++ libraries
+#include <algorithm> // std::max()
+#include <cmath>
+#include <exception>
+#include <mutex> // std::lock_guard
 #include <sstream> // std::ostringstream
+#include <utility> // std::move()
+#include <vector>
+
+namespace {
+
+  /// Range of beta gamma covered by the energy loss tables.
+  constexpr double kElossTableMinBetaGamma = 0.05;
+  constexpr double kElossTableMaxBetaGamma = 1.e5;
+
+  /// Range of validity of the drift velocity parameterizations.
+  constexpr double kDriftVelocityMaxEfield = 4.0;       // kV/cm
+  constexpr double kDriftVelocityMinTemperature = 87.0; // K
+  constexpr double kDriftVelocityMaxTemperature = 94.0; // K
+
+  /// Number of field gaps of the standard three wire plane layout.
+  constexpr unsigned int kStandardPlaneGaps = 3U;
+
+  /// Maximum energy [MeV] transferred to a delta ray by a particle of `mass`
+  /// [GeV/c^2] moving with beta gamma `bg`.
+  double
+  maxDeltaRayEnergy(double const bg, double const mass)
+  {
+    constexpr double me = 0.510998918;            // Electron mass (MeV/c^2).
+    double const gamma = std::sqrt(1. + bg * bg); // gamma.
+    double const mer = 0.001 * me / mass;         // electron mass / mass of incident particle.
+    return 2. * me * bg * bg / (1. + 2. * gamma * mer + mer * mer);
+  }
+
+  /// Returns the values of beta gamma in the range of the energy loss tables
+  /// where `f` changes sign.
+  template <typename F>
+  std::vector<double>
+  signChanges(F const& f)
+  {
+    // scan with a step of 0.01 in log(beta gamma), then bisect each change
+    constexpr unsigned int NSteps = 1600U;
+    double const minLog = std::log(kElossTableMinBetaGamma);
+    double const step = (std::log(kElossTableMaxBetaGamma) - minLog) / NSteps;
+
+    std::vector<double> changes;
+    double lowLog = minLog;
+    bool lowPositive = f(std::exp(lowLog)) > 0.;
+    for (unsigned int i = 1; i <= NSteps; ++i) {
+      double const highLog = minLog + i * step;
+      bool const highPositive = f(std::exp(highLog)) > 0.;
+      if (highPositive != lowPositive) {
+        double a = lowLog, b = highLog;
+        for (int iter = 0; iter < 60; ++iter) {
+          double const m = 0.5 * (a + b);
+          if ((f(std::exp(m)) > 0.) == lowPositive)
+            a = m;
+          else
+            b = m;
+        }
+        changes.push_back(std::exp(0.5 * (a + b)));
+      }
+      lowLog = highLog;
+      lowPositive = highPositive;
+    }
+    return changes;
+  }
+
+} // local namespace
 
 namespace detinfo {
 
@@ -36,6 +105,15 @@ namespace detinfo {
     ValidateAndConfigure(pset, ignore_params);
   }
 
+  //--------------------------------------------------------------------
+  DetectorPropertiesStandard::~DetectorPropertiesStandard()
+  {
+    PrintDriftVelocityRangeSummary();
+    if constexpr (instrumentation::Level > 0U) {
+      instrumentation::report(mf::LogInfo("DetectorPropertiesStandard"));
+    }
+  }
+
   //--------------------------------------------------------------------
   void
   DetectorPropertiesStandard::ValidateAndConfigure(fhicl::ParameterSet const& p,
@@ -81,19 +159,58 @@ namespace detinfo {
     fSternheimerParameters.x1 = config().SternheimerX1();
     fSternheimerParameters.cbar = config().SternheimerCbar();
 
+    BuildElossTables(
+      config().ElossTableMasses(), config().ElossTableTcuts(), config().ElossTableTolerance());
+
     fDriftVelFudgeFactor = config().DriftVelFudgeFactor();
 
     fUseIcarusMicrobooneDriftModel = config().UseIcarusMicrobooneDriftModel();
 
+    fMaxDriftVelocityRangeWarnings = config().MaxDriftVelocityRangeWarnings();
+    CheckDriftVelocityRange();
+
+    fConfiguredDriftVelocities.clear();
+    for (double const efield : fEfield)
+      fConfiguredDriftVelocities.emplace_back(efield, ComputeDriftVelocity(efield, fTemperature));
+
     fIncludeInterPlanePitchInXTickOffsets = config().IncludeInterPlanePitchInXTickOffsets();
 
     fSimpleBoundary = config().SimpleBoundary();
+
+    PrecomputeXTicksTerms();
+
+    std::lock_guard<std::mutex> const lock{fDataSnapshotMutex};
+    publishDataSnapshot(fNumberTimeSamples);
+  }
+
+  //------------------------------------------------------------------------------------//
+  void
+  DetectorPropertiesStandard::SetNumberTimeSamples(unsigned int const nsamp)
+  {
+    fNumberTimeSamples = nsamp;
+    // the data already computed hold the old value: switch to the ones for the new value
+    std::lock_guard<std::mutex> const lock{fDataSnapshotMutex};
+    publishDataSnapshot(nsamp);
+  }
+
+  //------------------------------------------------------------------------------------//
+  void
+  DetectorPropertiesStandard::publishDataSnapshot(unsigned int const nsamp) const
+  {
+    for (auto const& snapshot : fDataSnapshots) {
+      if (snapshot->numberTimeSamples != nsamp) continue;
+      fDataSnapshot.store(snapshot.get(), std::memory_order_release);
+      return;
+    }
+    fDataSnapshots.push_back(std::make_unique<DataSnapshot_t>(nsamp));
+    fDataSnapshot.store(fDataSnapshots.back().get(), std::memory_order_release);
   }
 
   //------------------------------------------------------------------------------------//
   double
   DetectorPropertiesStandard::Efield(unsigned int const planegap) const
   {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::Efield");
     if (planegap >= fEfield.size())
       throw cet::exception("DetectorPropertiesStandard")
         << "requesting Electric field in a plane gap that is not defined\n";
@@ -105,6 +222,7 @@ namespace detinfo {
   double
   DetectorPropertiesStandard::Density(double temperature) const
   {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::Density");
     // Default temperature use internal value.
     if (temperature == 0.) temperature = Temperature();
 
@@ -129,19 +247,93 @@ namespace detinfo {
   // pdg web site http://pdg.lbl.gov/AtomicNuclearProperties/
   //
   double
-  DetectorPropertiesStandard::Eloss(double mom, double mass, double tcut) const
+  DetectorPropertiesStandard::Eloss(double const mom, double const mass, double const tcut) const
   {
-    // Some constants.
-    constexpr double K = 0.307075;     // 4 pi N_A r_e^2 m_e c^2 (MeV cm^2/mol).
-    constexpr double me = 0.510998918; // Electron mass (MeV/c^2).
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::Eloss");
+    if (ElossTable const* table = ElossTableFor(mass, tcut)) {
+      double const bg = mom / mass;
+      if (table->Covers(bg)) return (*table)(bg);
+    }
+    return ElossAnalytic(mom, mass, tcut);
+  }
+
+  //----------------------------------------------------------------------------------
+  double
+  DetectorPropertiesStandard::ElossAnalytic(double const mom,
+                                            double const mass,
+                                            double const tcut) const
+  {
+    return ElossFormula(mom, mass, tcut, ElossConstants());
+  }
+
+  //----------------------------------------------------------------------------------
+  void
+  DetectorPropertiesStandard::Eloss(double const* mom,
+                                    std::size_t const n,
+                                    double* dEdx,
+                                    double const mass,
+                                    double const tcut) const
+  {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::Eloss[batch]");
+    ElossConstants_t const constants = ElossConstants();
+    if (ElossTable const* table = ElossTableFor(mass, tcut)) {
+      for (std::size_t i = 0; i < n; ++i) {
+        double const bg = mom[i] / mass;
+        dEdx[i] = table->Covers(bg) ? (*table)(bg) : ElossFormula(mom[i], mass, tcut, constants);
+      }
+    }
+    else {
+      for (std::size_t i = 0; i < n; ++i)
+        dEdx[i] = ElossFormula(mom[i], mass, tcut, constants);
+    }
+  }
 
+  //----------------------------------------------------------------------------------
+  DetectorPropertiesStandard::ElossConstants_t
+  DetectorPropertiesStandard::ElossConstants() const
+  {
+    constexpr double K = 0.307075; // 4 pi N_A r_e^2 m_e c^2 (MeV cm^2/mol).
+    return {Density() * K * fLP->AtomicNumber(),
+            fLP->AtomicMass(),
+            1.e-12 * cet::square(fLP->ExcitationEnergy())};
+  }
+
+  //----------------------------------------------------------------------------------
+  double
+  DetectorPropertiesStandard::ElossFormula(double const mom,
+                                           double const mass,
+                                           double tcut,
+                                           ElossConstants_t const& constants) const
+  {
     // Calculate kinematic quantities.
     double const bg = mom / mass;            // beta*gamma.
     double const gamma = sqrt(1. + bg * bg); // gamma.
     double const beta = bg / gamma;          // beta (velocity).
-    double const mer = 0.001 * me / mass;    // electron mass / mass of incident particle.
-    double const tmax =
-      2. * me * bg * bg / (1. + 2. * gamma * mer + mer * mer); // Maximum delta ray energy (MeV).
+
+    // Calculate stopping number.
+    double B = ElossStoppingNumber(bg, mass, tcut, constants.I2);
+
+    // Don't let the stopping number become negative.
+    if (B < 1.) B = 1.;
+
+    // Calculate dE/dx.
+    return constants.rhoKZ * B / (constants.A * beta * beta);
+  }
+
+  //----------------------------------------------------------------------------------
+  double
+  DetectorPropertiesStandard::ElossStoppingNumber(double const bg,
+                                                  double const mass,
+                                                  double tcut,
+                                                  double const I2) const
+  {
+    // Some constants.
+    constexpr double me = 0.510998918; // Electron mass (MeV/c^2).
+
+    // Calculate kinematic quantities.
+    double const gamma = std::sqrt(1. + bg * bg);    // gamma.
+    double const beta = bg / gamma;                  // beta (velocity).
+    double const tmax = maxDeltaRayEnergy(bg, mass); // Maximum delta ray energy (MeV).
 
     // Make sure tcut does not exceed tmax.
     if (tcut == 0. || tcut > tmax) tcut = tmax;
@@ -156,38 +348,126 @@ namespace detinfo {
                  std::pow(fSternheimerParameters.x1 - x, fSternheimerParameters.k);
     }
 
-    // Calculate stopping number.
-    double B =
-      0.5 * std::log(2. * me * bg * bg * tcut / (1.e-12 * cet::square(fLP->ExcitationEnergy()))) -
-      0.5 * beta * beta * (1. + tcut / tmax) - 0.5 * delta;
+    return 0.5 * std::log(2. * me * bg * bg * tcut / I2) - 0.5 * beta * beta * (1. + tcut / tmax) -
+           0.5 * delta;
+  }
 
-    // Don't let the stopping number become negative.
-    if (B < 1.) B = 1.;
+  //----------------------------------------------------------------------------------
+  std::vector<double>
+  DetectorPropertiesStandard::ElossKinks(double const mass, double const tcut) const
+  {
+    // thresholds of the density effect correction
+    std::vector<double> kinks{std::pow(10., fSternheimerParameters.x0),
+                              std::pow(10., fSternheimerParameters.x1)};
+
+    // switch from the maximum delta ray energy to the cut
+    if (tcut > 0.) {
+      for (double const bg : signChanges([mass, tcut](double const bg) {
+             return maxDeltaRayEnergy(bg, mass) - tcut;
+           }))
+        kinks.push_back(bg);
+    }
 
-    // Calculate dE/dx.
-    return Density() * K * fLP->AtomicNumber() * B / (fLP->AtomicMass() * beta * beta);
+    // stopping number clamped to 1
+    double const I2 = ElossConstants().I2;
+    for (double const bg : signChanges([this, mass, tcut, I2](double const bg) {
+           return ElossStoppingNumber(bg, mass, tcut, I2) - 1.;
+         }))
+      kinks.push_back(bg);
+
+    return kinks;
+  }
+
+  //----------------------------------------------------------------------------------
+  ElossTable const*
+  DetectorPropertiesStandard::ElossTableFor(double const mass, double const tcut) const
+  {
+    for (auto const& entry : fElossTables) {
+      if ((entry.mass == mass) && (entry.tcut == tcut)) return &entry.table;
+    }
+    return nullptr;
+  }
+
+  //----------------------------------------------------------------------------------
+  void
+  DetectorPropertiesStandard::BuildElossTables(std::vector<double> const& masses,
+                                               std::vector<double> const& tcuts,
+                                               double const tolerance)
+  {
+    fElossTables.clear();
+    if (masses.empty()) return;
+
+    mf::LogInfo log("DetectorPropertiesStandard");
+    log << "Energy loss tables (tolerance: " << tolerance << "):";
+    for (double const mass : masses) {
+      for (double const tcut : tcuts) {
+        auto const dEdx = [this, mass, tcut](double const bg) {
+          return ElossAnalytic(bg * mass, mass, tcut);
+        };
+        try {
+          fElossTables.push_back({mass,
+                                  tcut,
+                                  ElossTable{dEdx,
+                                             kElossTableMinBetaGamma,
+                                             kElossTableMaxBetaGamma,
+                                             ElossKinks(mass, tcut),
+                                             tolerance}});
+        }
+        catch (std::exception const& e) {
+          throw cet::exception("DetectorPropertiesStandard")
+            << "Can't tabulate energy loss for mass " << mass << " GeV/c^2 and tcut " << tcut
+            << " MeV:\n"
+            << e.what() << "\n";
+        }
+        auto const& table = fElossTables.back().table;
+        log << "\n  mass " << mass << " GeV/c^2, tcut " << tcut << " MeV: " << table.NNodes()
+            << " nodes in " << table.NSegments()
+            << " parts, max relative error " << table.MaxRelativeError();
+      } // for tcut
+    }   // for mass
   }
 
   //----------------------------------------------------------------------------------
   double
   DetectorPropertiesStandard::ElossVar(double const mom, double const mass) const
   {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::ElossVar");
+    double var;
+    ElossVar(&mom, 1U, &var, mass);
+    return var;
+  }
+
+  //----------------------------------------------------------------------------------
+  void
+  DetectorPropertiesStandard::ElossVar(double const* mom,
+                                       std::size_t const n,
+                                       double* var,
+                                       double const mass) const
+  {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::ElossVar[batch]");
     // Some constants.
     constexpr double K = 0.307075;     // 4 pi N_A r_e^2 m_e c^2 (MeV cm^2/mol).
     constexpr double me = 0.510998918; // Electron mass (MeV/c^2).
 
-    // Calculate kinematic quantities.
-    double const bg = mom / mass;          // beta*gamma.
-    double const gamma2 = 1. + bg * bg;    // gamma^2.
-    double const beta2 = bg * bg / gamma2; // beta^2.
-    return gamma2 * (1. - 0.5 * beta2) * me * (fLP->AtomicNumber() / fLP->AtomicMass()) * K *
-           Density();
+    // only the provider queries are hoisted: the products keep the order of
+    // the original formula, so that the results do not change in any digit
+    double const ZoverA = fLP->AtomicNumber() / fLP->AtomicMass();
+    double const density = Density();
+
+    for (std::size_t i = 0; i < n; ++i) {
+      // Calculate kinematic quantities.
+      double const bg = mom[i] / mass;       // beta*gamma.
+      double const gamma2 = 1. + bg * bg;    // gamma^2.
+      double const beta2 = bg * bg / gamma2; // beta^2.
+      var[i] = gamma2 * (1. - 0.5 * beta2) * me * ZoverA * K * density;
+    }
   }
 
   //------------------------------------------------------------------------------------//
   double
   DetectorPropertiesStandard::DriftVelocity(double efield, double temperature) const
   {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::DriftVelocity");
     // Drift Velocity as a function of Electric Field and LAr Temperature
     // from : W. Walkowiak, NIM A 449 (2000) 288-294
     //
@@ -198,26 +478,31 @@ namespace detinfo {
     // Efield should have units of kV/cm
     // Temperature should have units of Kelvin
 
-    // Default Efield, use internal value.
-    if (efield == 0.) efield = Efield();
-
-    if (efield > 4.0)
-      mf::LogWarning("DetectorPropertiesStandard")
-        << "DriftVelocity Warning! : E-field value of " << efield
-        << " kV/cm is outside of range covered by drift"
-        << " velocity parameterization. Returned value"
-        << " may not be correct";
-
-    // Default temperature use internal value.
-    if (temperature == 0.) temperature = Temperature();
-
-    if (temperature < 87.0 || temperature > 94.0)
-      mf::LogWarning("DetectorPropertiesStandard")
-        << "DriftVelocity Warning! : Temperature value of " << temperature
-        << " K is outside of range covered by drift velocity"
-        << " parameterization. Returned value may not be"
-        << " correct";
+    // Default Efield, use internal value (checked at configuration).
+    if (efield == 0.)
+      efield = Efield();
+    else if (efield > kDriftVelocityMaxEfield)
+      EfieldOutOfRange(efield);
+
+    // Default temperature use internal value (checked at configuration).
+    if (temperature == 0.)
+      temperature = Temperature();
+    else if (temperature < kDriftVelocityMinTemperature ||
+             temperature > kDriftVelocityMaxTemperature)
+      TemperatureOutOfRange(temperature);
+
+    if (temperature == fTemperature) {
+      for (auto const& [configuredEfield, vd] : fConfiguredDriftVelocities)
+        if (configuredEfield == efield) return vd;
+    }
+    return ComputeDriftVelocity(efield, temperature);
+  }
 
+  //------------------------------------------------------------------------------------//
+  double
+  DetectorPropertiesStandard::ComputeDriftVelocity(double const efield,
+                                                   double const temperature) const
+  {
     double vd;
 
     if (!fUseIcarusMicrobooneDriftModel) {
@@ -290,6 +575,75 @@ namespace detinfo {
     return vd; // in cm/us
   }
 
+  //------------------------------------------------------------------------------------//
+  void
+  DetectorPropertiesStandard::CheckDriftVelocityRange() const
+  {
+    // the default field is the one used when none is specified
+    double const efield = Efield();
+    if (efield > kDriftVelocityMaxEfield)
+      mf::LogWarning("DetectorPropertiesStandard")
+        << "DriftVelocity Warning! : configured E-field value of " << efield
+        << " kV/cm is outside of range covered by drift"
+        << " velocity parameterization. Returned value"
+        << " may not be correct";
+
+    double const temperature = Temperature();
+    if (temperature < kDriftVelocityMinTemperature || temperature > kDriftVelocityMaxTemperature)
+      mf::LogWarning("DetectorPropertiesStandard")
+        << "DriftVelocity Warning! : configured temperature value of " << temperature
+        << " K is outside of range covered by drift velocity"
+        << " parameterization. Returned value may not be"
+        << " correct";
+  }
+
+  //------------------------------------------------------------------------------------//
+  void
+  DetectorPropertiesStandard::EfieldOutOfRange(double const efield) const
+  {
+    unsigned long const n = fNEfieldOutOfRange.fetch_add(1U, std::memory_order_relaxed);
+    if (n >= fMaxDriftVelocityRangeWarnings) return;
+
+    mf::LogWarning log("DetectorPropertiesStandard");
+    log << "DriftVelocity Warning! : E-field value of " << efield
+        << " kV/cm is outside of range covered by drift"
+        << " velocity parameterization. Returned value"
+        << " may not be correct";
+    if (n + 1 == fMaxDriftVelocityRangeWarnings)
+      log << "\nFurther occurrences will be counted but not reported.";
+  }
+
+  //------------------------------------------------------------------------------------//
+  void
+  DetectorPropertiesStandard::TemperatureOutOfRange(double const temperature) const
+  {
+    unsigned long const n = fNTemperatureOutOfRange.fetch_add(1U, std::memory_order_relaxed);
+    if (n >= fMaxDriftVelocityRangeWarnings) return;
+
+    mf::LogWarning log("DetectorPropertiesStandard");
+    log << "DriftVelocity Warning! : Temperature value of " << temperature
+        << " K is outside of range covered by drift velocity"
+        << " parameterization. Returned value may not be"
+        << " correct";
+    if (n + 1 == fMaxDriftVelocityRangeWarnings)
+      log << "\nFurther occurrences will be counted but not reported.";
+  }
+
+  //------------------------------------------------------------------------------------//
+  void
+  DetectorPropertiesStandard::PrintDriftVelocityRangeSummary() const
+  {
+    unsigned long const nEfield = fNEfieldOutOfRange.load(std::memory_order_relaxed);
+    unsigned long const nTemperature = fNTemperatureOutOfRange.load(std::memory_order_relaxed);
+    if (nEfield == 0U && nTemperature == 0U) return;
+
+    mf::LogWarning("DetectorPropertiesStandard")
+      << "DriftVelocity was called " << nEfield << " times with the E-field above "
+      << kDriftVelocityMaxEfield << " kV/cm and " << nTemperature
+      << " times with the temperature outside [ " << kDriftVelocityMinTemperature << " ; "
+      << kDriftVelocityMaxTemperature << " ] K, where the parameterization is not valid.";
+  }
+
   //----------------------------------------------------------------------------------
   // The below function assumes that the user has applied the lifetime
   // correction and effective pitch between the wires (usually after 3D
@@ -307,17 +661,34 @@ namespace detinfo {
   double
   DetectorPropertiesStandard::BirksCorrection(double dQdx, double E_field) const
   {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::BirksCorrection");
     // Correction for charge quenching using parameterization from
     // S.Amoruso et al., NIM A 523 (2004) 275
+    return BirksModel{Density(), E_field}.EnergyLoss(dQdx); // MeV/cm
+  }
 
-    constexpr double A3t = util::kRecombA;
-    double K3t = util::kRecombk;                                    // in KV/cm*(g/cm^2)/MeV
-    double const rho = Density();                                   // LAr density in g/cm^3
-    constexpr double Wion = 1000. / util::kGeVToElectrons;          // 23.6 eV = 1e, Wion in MeV/e
-    K3t /= rho;                                                     // KV/MeV
-    double const dEdx = dQdx / (A3t / Wion - K3t / E_field * dQdx); // MeV/cm
+  void
+  DetectorPropertiesStandard::BirksCorrection(double const* dQdx,
+                                              std::size_t const n,
+                                              double* dEdx,
+                                              double const E_field) const
+  {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::BirksCorrection[batch]");
+    BirksModel const model{Density(), E_field};
+    for (std::size_t i = 0; i < n; ++i)
+      dEdx[i] = model.EnergyLoss(dQdx[i]);
+  }
 
-    return dEdx;
+  void
+  DetectorPropertiesStandard::BirksCorrection(double const* dQdx,
+                                              std::size_t const n,
+                                              double* dEdx,
+                                              double const* E_field) const
+  {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::BirksCorrection[batch, fields]");
+    double const rho = Density(); // LAr density in g/cm^3
+    for (std::size_t i = 0; i < n; ++i)
+      dEdx[i] = BirksModel{rho, E_field[i]}.EnergyLoss(dQdx[i]);
   }
 
   //----------------------------------------------------------------------------------
@@ -330,15 +701,92 @@ namespace detinfo {
   double
   DetectorPropertiesStandard::ModBoxCorrection(double dQdx, double E_field) const
   {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::ModBoxCorrection");
     // Modified Box model correction has better behavior than the Birks
     // correction at high values of dQ/dx.
-    double const rho = Density();                          // LAr density in g/cm^3
-    constexpr double Wion = 1000. / util::kGeVToElectrons; // 23.6 eV = 1e, Wion in MeV/e
-    double const Beta = util::kModBoxB / (rho * E_field);
-    constexpr double Alpha = util::kModBoxA;
-    double const dEdx = (exp(Beta * Wion * dQdx) - Alpha) / Beta;
+    return ModBoxModel{Density(), E_field}.EnergyLoss(dQdx); // MeV/cm
+  }
 
-    return dEdx;
+  void
+  DetectorPropertiesStandard::ModBoxCorrection(double const* dQdx,
+                                               std::size_t const n,
+                                               double* dEdx,
+                                               double const E_field) const
+  {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::ModBoxCorrection[batch]");
+    ModBoxModel const model{Density(), E_field};
+    for (std::size_t i = 0; i < n; ++i)
+      dEdx[i] = model.EnergyLoss(dQdx[i]);
+  }
+
+  void
+  DetectorPropertiesStandard::ModBoxCorrection(double const* dQdx,
+                                               std::size_t const n,
+                                               double* dEdx,
+                                               double const* E_field) const
+  {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::ModBoxCorrection[batch, fields]");
+    double const rho = Density(); // LAr density in g/cm^3
+    for (std::size_t i = 0; i < n; ++i)
+      dEdx[i] = ModBoxModel{rho, E_field[i]}.EnergyLoss(dQdx[i]);
+  }
+
+  //----------------------------------------------------------------------------------
+  // Inverse recombination corrections: from dE/dx in MeV/cm to dQ/dx in electrons/cm
+  double
+  DetectorPropertiesStandard::InverseBirksCorrection(double dEdx, double E_field) const
+  {
+    return BirksModel{Density(), E_field}.Charge(dEdx);
+  }
+
+  void
+  DetectorPropertiesStandard::InverseBirksCorrection(double const* dEdx,
+                                                     std::size_t const n,
+                                                     double* dQdx,
+                                                     double const E_field) const
+  {
+    BirksModel const model{Density(), E_field};
+    for (std::size_t i = 0; i < n; ++i)
+      dQdx[i] = model.Charge(dEdx[i]);
+  }
+
+  void
+  DetectorPropertiesStandard::InverseBirksCorrection(double const* dEdx,
+                                                     std::size_t const n,
+                                                     double* dQdx,
+                                                     double const* E_field) const
+  {
+    double const rho = Density(); // LAr density in g/cm^3
+    for (std::size_t i = 0; i < n; ++i)
+      dQdx[i] = BirksModel{rho, E_field[i]}.Charge(dEdx[i]);
+  }
+
+  double
+  DetectorPropertiesStandard::InverseModBoxCorrection(double dEdx, double E_field) const
+  {
+    return ModBoxModel{Density(), E_field}.Charge(dEdx);
+  }
+
+  void
+  DetectorPropertiesStandard::InverseModBoxCorrection(double const* dEdx,
+                                                      std::size_t const n,
+                                                      double* dQdx,
+                                                      double const E_field) const
+  {
+    ModBoxModel const model{Density(), E_field};
+    for (std::size_t i = 0; i < n; ++i)
+      dQdx[i] = model.Charge(dEdx[i]);
+  }
+
+  void
+  DetectorPropertiesStandard::InverseModBoxCorrection(double const* dEdx,
+                                                      std::size_t const n,
+                                                      double* dQdx,
+                                                      double const* E_field) const
+  {
+    double const rho = Density(); // LAr density in g/cm^3
+    for (std::size_t i = 0; i < n; ++i)
+      dQdx[i] = ModBoxModel{rho, E_field[i]}.Charge(dEdx[i]);
   }
 
   //--------------------------------------------------------------------
@@ -354,105 +802,186 @@ namespace detinfo {
   DetectorPropertiesData
   DetectorPropertiesStandard::DataFor(detinfo::DetectorClocksData const& clock_data) const
   {
-    double const samplingRate = sampling_rate(clock_data);
-    double const efield = Efield();
-    double const temperature = Temperature();
-    double const driftVelocity = DriftVelocity(efield, temperature);
-    double const x_ticks_coefficient = 0.001 * driftVelocity * samplingRate;
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::DataFor");
+    // the copy shares the conversion table with the cached object
+    return *SharedDataFor(clock_data);
+  }
+
+  //--------------------------------------------------------------------
+  std::shared_ptr<DetectorPropertiesData const>
+  DetectorPropertiesStandard::SharedDataFor(detinfo::DetectorClocksData const& clock_data) const
+  {
+    DETINFO_INSTRUMENTED_CALL("DetectorPropertiesStandard::SharedDataFor");
+    // only the sampling rate and the trigger offset come from the clocks
+    DataCacheKey_t const key{sampling_rate(clock_data), trigger_offset(clock_data)};
+
+    DataSnapshot_t const* snapshot = fDataSnapshot.load(std::memory_order_acquire);
+    std::size_t nEntries = snapshot->nEntries.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < nEntries; ++i)
+      if (snapshot->keys[i] == key) return snapshot->data[i];
+
+    auto data = std::make_shared<DetectorPropertiesData const>(
+      ComputeDataFor(key.samplingRate, key.triggerOffset));
+
+    // a full set stays full: no need to wait for the lock to find out
+    snapshot = fDataSnapshot.load(std::memory_order_acquire);
+    if (snapshot->nEntries.load(std::memory_order_acquire) == MaxDataCacheSize) return data;
+
+    std::lock_guard<std::mutex> const lock{fDataSnapshotMutex};
+    DataSnapshot_t* current = fDataSnapshot.load(std::memory_order_relaxed);
+    // the number of ticks changed in the meanwhile: do not keep the data
+    if (current->numberTimeSamples != data->NumberTimeSamples()) return data;
+
+    nEntries = current->nEntries.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < nEntries; ++i) // another thread may have been faster
+      if (current->keys[i] == key) return current->data[i];
+    if (nEntries == MaxDataCacheSize) return data; // no more room
+
+    current->keys[nEntries] = key;
+    current->data[nEntries] = data;
+    current->nEntries.store(nEntries + 1U, std::memory_order_release);
+    return data;
+  }
+
+  //--------------------------------------------------------------------
+  DetectorPropertiesData
+  DetectorPropertiesStandard::ComputeDataFor(double const samplingRate,
+                                             int const triggerOffset) const
+  {
+    // everything else was computed by PrecomputeXTicksTerms()
+    double const x_ticks_coefficient = fXTicksDriftSpeed * samplingRate;
+
+    XTicksTable x_ticks{fXTicksLayout};
+    std::size_t iTPC = 0U, iPlane = 0U;
+    for (unsigned int cstat = 0; cstat < x_ticks.NCryostats(); ++cstat) {
+      for (unsigned int tpc = 0; tpc < x_ticks.NTPCs(cstat); ++tpc, ++iTPC) {
+        x_ticks.SetCoefficient(tpc, cstat, fTPCDriftDirections[iTPC] * x_ticks_coefficient);
+        unsigned int const nplane = x_ticks.NPlanes(tpc, cstat);
+        for (unsigned int plane = 0; plane < nplane; ++plane, ++iPlane) {
+          x_ticks.SetOffset(plane,
+                            tpc,
+                            cstat,
+                            fPlaneDriftTimes[iPlane] / samplingRate + triggerOffset +
+                              fPlaneTickOffsets[iPlane]);
+        }
+      }
+    }
 
-    double const triggerOffset = trigger_offset(clock_data);
+    return DetectorPropertiesData{*this, x_ticks_coefficient, std::move(x_ticks)};
+  }
 
-    std::vector<std::vector<std::vector<double>>> x_ticks_offsets(fGeo->Ncryostats());
-    std::vector<std::vector<double>> drift_direction(fGeo->Ncryostats());
+  //--------------------------------------------------------------------
+  // The x/ticks offset of each plane is
+  //
+  //     offset = drift time / sampling rate + trigger offset + view offset
+  //
+  // where only the sampling rate and the trigger offset depend on the clocks.
+  // Drift time and view offset are computed here once from the geometry.
+  void
+  DetectorPropertiesStandard::PrecomputeXTicksTerms()
+  {
+    // the configured values have already been checked against the range of
+    // the parameterization: they are not counted again as out of range
+    double const temperature = Temperature();
+    fXTicksDriftSpeed = 0.001 * ComputeDriftVelocity(Efield(), temperature); // cm/ns
 
+    // the table is laid out first, then filled by ComputeDataFor()
+    std::vector<std::vector<unsigned int>> nPlanes(fGeo->Ncryostats());
     for (size_t cstat = 0; cstat < fGeo->Ncryostats(); ++cstat) {
-      x_ticks_offsets[cstat].resize(fGeo->Cryostat(cstat).NTPC());
-      drift_direction[cstat].resize(fGeo->Cryostat(cstat).NTPC());
+      for (size_t tpc = 0; tpc < fGeo->Cryostat(cstat).NTPC(); ++tpc)
+        nPlanes[cstat].push_back(fGeo->Cryostat(cstat).TPC(tpc).Nplanes());
+    }
+    fXTicksLayout = XTicksTable{nPlanes};
+
+    fTPCDriftDirections.clear();
+    fPlaneDriftTimes.clear();
+    fPlaneTickOffsets.clear();
+
+    // drift speeds in the gaps between planes, in cm/ns: gap `0` is the main
+    // drift volume, gap `i` the one in front of the `i`-th plane
+    std::vector<double> gapDriftSpeeds;
+    if (fIncludeInterPlanePitchInXTickOffsets) {
+      for (unsigned int igap = 0; igap < fEfield.size(); ++igap)
+        gapDriftSpeeds.push_back(0.001 * ComputeDriftVelocity(Efield(igap), temperature));
+    }
 
+    for (size_t cstat = 0; cstat < fGeo->Ncryostats(); ++cstat) {
       for (size_t tpc = 0; tpc < fGeo->Cryostat(cstat).NTPC(); ++tpc) {
         const geo::TPCGeo& tpcgeom = fGeo->Cryostat(cstat).TPC(tpc);
 
         const double dir((tpcgeom.DriftDirection() == geo::kNegX) ? +1.0 : -1.0);
-        drift_direction[cstat][tpc] = dir;
+        fTPCDriftDirections.push_back(dir);
+
+        // Calculate geometric time offset.
+        // only works if xyz[0]<=0
+        const double* xyz = tpcgeom.PlaneLocation(0);
+
+        double driftTime = -xyz[0] / (dir * fXTicksDriftSpeed); // ns
+
+        unsigned int const nplane = tpcgeom.Nplanes();
+
+        // the field configuration describes at least the three gaps of the
+        // standard wire plane layout; a TPC with fewer planes (like ArgoNeuT)
+        // misses the first induction planes, and a TPC with more planes needs
+        // one gap per plane; plane `p` is behind gap `firstGap + p - 1`, and
+        // gaps beyond the last plane of the TPC are ignored
+        unsigned int firstGap = 1U;
+        if (fIncludeInterPlanePitchInXTickOffsets && (nplane > 1U)) {
+          unsigned int const nGaps = std::max(nplane, kStandardPlaneGaps);
+          if (gapDriftSpeeds.size() < nGaps) {
+            throw cet::exception("DetectorPropertiesStandard")
+              << "requesting Electric field in a plane gap that is not defined\n";
+          }
+          /*
+            |    ---------- plane = 1 (collection)
+            |                      Coeff[2]
+            |    ---------- plane = 0 (2nd induction) x = xyz[0]
+            |    ---------- x = 0, Coeff[1]
+            V    ---------- first induction plane (missing)
+            x                      Coeff[0]
+            For plane = 0, t offset is pitch/Coeff[1] -
+            (pitch+xyz[0])/Coeff[0] = -xyz[0]/Coeff[0] -
+            pitch*(1/Coeff[0]-1/Coeff[1])
+          */
+          firstGap = nGaps - nplane + 1U;
+          for (unsigned int igap = 1U; igap < firstGap; ++igap)
+            driftTime -= tpcgeom.PlanePitch() * (1 / fXTicksDriftSpeed - 1 / gapDriftSpeeds[igap]);
+        }
 
-        int nplane = tpcgeom.Nplanes();
-        x_ticks_offsets[cstat][tpc].resize(nplane, 0.);
-        for (int plane = 0; plane < nplane; ++plane) {
+        for (unsigned int plane = 0; plane < nplane; ++plane) {
           const geo::PlaneGeo& pgeom = tpcgeom.Plane(plane);
 
-          // Calculate geometric time offset.
-          // only works if xyz[0]<=0
-          const double* xyz = tpcgeom.PlaneLocation(0);
-
-          x_ticks_offsets[cstat][tpc][plane] =
-            -xyz[0] / (dir * x_ticks_coefficient) + triggerOffset;
-
-          if(fIncludeInterPlanePitchInXTickOffsets){
-            // Get field in gap between planes
-            double efieldgap[3];
-            double driftVelocitygap[3];
-            double x_ticks_coefficient_gap[3];
-            for (int igap = 0; igap < 3; ++igap) {
-              efieldgap[igap] = Efield(igap);
-              driftVelocitygap[igap] = DriftVelocity(efieldgap[igap], temperature);
-              x_ticks_coefficient_gap[igap] = 0.001 * driftVelocitygap[igap] * samplingRate;
-            }
-
-            if (nplane == 3) {
-              /*
-                |    ---------- plane = 2 (collection)
-                |                      Coeff[2]
-                |    ---------- plane = 1 (2nd induction)
-                |                      Coeff[1]
-                |    ---------- plane = 0 (1st induction) x = xyz[0]
-                |                      Coeff[0]
-                |    ---------- x = 0
-                V     For plane = 0, t offset is -xyz[0]/Coeff[0]
-                x   */
-              for (int ip = 0; ip < plane; ++ip) {
-                x_ticks_offsets[cstat][tpc][plane] +=
-                  tpcgeom.PlanePitch(ip, ip + 1) / x_ticks_coefficient_gap[ip + 1];
-              }
-            }
-            else if (nplane == 2) { ///< special case for ArgoNeuT
-              /*
-                |    ---------- plane = 1 (collection)
-                |                      Coeff[2]
-                |    ---------- plane = 0 (2nd induction) x = xyz[0]
-                |    ---------- x = 0, Coeff[1]
-                V    ---------- first induction plane
-                x                      Coeff[0]
-                For plane = 0, t offset is pitch/Coeff[1] -
-                (pitch+xyz[0])/Coeff[0] = -xyz[0]/Coeff[0] -
-                pitch*(1/Coeff[0]-1/Coeff[1])
-              */
-              for (int ip = 0; ip < plane; ++ip) {
-                x_ticks_offsets[cstat][tpc][plane] +=
-                  tpcgeom.PlanePitch(ip, ip + 1) / x_ticks_coefficient_gap[ip + 2];
-              }
-              x_ticks_offsets[cstat][tpc][plane] -=
-                tpcgeom.PlanePitch() * (1 / x_ticks_coefficient - 1 / x_ticks_coefficient_gap[1]);
-            }
-
-          } // end if fIncludeInterPlanePitchInXTickOffsets
+          /*
+            |    ---------- plane = 2 (collection)
+            |                      Coeff[2]
+            |    ---------- plane = 1 (2nd induction)
+            |                      Coeff[1]
+            |    ---------- plane = 0 (1st induction) x = xyz[0]
+            |                      Coeff[0]
+            |    ---------- x = 0
+            V     For plane = 0, t offset is -xyz[0]/Coeff[0]
+            x   */
+          if (fIncludeInterPlanePitchInXTickOffsets && (plane > 0U)) {
+            driftTime +=
+              tpcgeom.PlanePitch(plane - 1, plane) / gapDriftSpeeds[firstGap + plane - 1];
+          }
+
+          fPlaneDriftTimes.push_back(driftTime);
 
           // Add view dependent offset
           // FIXME the offset should be plane-dependent
           geo::View_t view = pgeom.View();
           switch (view) {
-          case geo::kU: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetU; break;
-          case geo::kV: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetV; break;
-          case geo::kZ: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetZ; break;
-          case geo::kY: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetY; break;
-          case geo::kX: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetX; break;
+          case geo::kU: fPlaneTickOffsets.push_back(fTimeOffsetU); break;
+          case geo::kV: fPlaneTickOffsets.push_back(fTimeOffsetV); break;
+          case geo::kZ: fPlaneTickOffsets.push_back(fTimeOffsetZ); break;
+          case geo::kY: fPlaneTickOffsets.push_back(fTimeOffsetY); break;
+          case geo::kX: fPlaneTickOffsets.push_back(fTimeOffsetX); break;
           default: throw cet::exception(__FUNCTION__) << "Bad view = " << view << "\n";
           } // switch
         }
       }
     }
-
-    return DetectorPropertiesData{
-      *this, x_ticks_coefficient, move(x_ticks_offsets), move(drift_direction)};
   }
 
   std::string
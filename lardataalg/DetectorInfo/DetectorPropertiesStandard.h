@@ -17,6 +17,7 @@
 #include "lardataalg/DetectorInfo/DetectorClocks.h"
 #include "lardataalg/DetectorInfo/DetectorProperties.h"
 #include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/ElossTable.h"
 #include "lardataalg/DetectorInfo/LArProperties.h"
 
 // framework libraries
@@ -27,7 +28,14 @@
 #include "fhiclcpp/types/Sequence.h"
 
 // C/C++ standard libraries
+#include <array>
+#include <atomic>
+#include <cstddef> // std::size_t
+#include <memory>  // std::shared_ptr, std::unique_ptr
+#include <mutex>
 #include <set>
+#include <utility> // std::pair
+#include <vector>
 
 /// General LArSoft Utilities
 namespace detinfo {
@@ -103,6 +111,20 @@ namespace detinfo {
         Name("SternheimerCbar"),
         Comment("parameter cbar of Sternheimer correction delta = 2log(10) x - "
                 "cbar + { a (x_1-x)^k } theta(x1-x), x = log10(p/m)")};
+      fhicl::Sequence<double> ElossTableMasses{
+        Name("ElossTableMasses"),
+        Comment("masses [GeV/c^2] of the particles whose energy loss is tabulated "
+                "instead of computed at each call (empty: always compute)"),
+        std::vector<double>{}};
+      fhicl::Sequence<double> ElossTableTcuts{
+        Name("ElossTableTcuts"),
+        Comment("maximum delta ray energies [MeV] tabulated for each of the "
+                "ElossTableMasses (0 for unrestricted energy loss)"),
+        std::vector<double>{0.}};
+      fhicl::Atom<double> ElossTableTolerance{
+        Name("ElossTableTolerance"),
+        Comment("maximum relative interpolation error of tabulated energy loss"),
+        1e-4};
       fhicl::Atom<double> DriftVelFudgeFactor{
         Name("DriftVelFudgeFactor"),
         Comment("Allows a scaling factor to fudge the drift velocity "
@@ -114,13 +136,24 @@ namespace detinfo {
                 "model for velocity calculation as in arXiv:2008.09765"),
         false};
 
+      fhicl::Atom<unsigned int> MaxDriftVelocityRangeWarnings{
+        Name("MaxDriftVelocityRangeWarnings"),
+        Comment("number of warnings about electric field or temperature outside "
+                "the drift velocity parameterization range to print; further "
+                "occurrences are only counted and summarised at destruction"),
+        1U};
+
       fhicl::Atom<bool> IncludeInterPlanePitchInXTickOffsets{
         Name("IncludeInterPlanePitchInXTickOffsets"),
         Comment("Historically, ConvertTicksToX has allowed for the drift time "
                 "between the wire planes. This is appropriate for "
                 "recob::RawDigits, and recob::Wires from the 1D unfolding, "
                 "but is not appropriate for recob::Wires from WireCell. "
-                "The default value is 'true', retaining the 'classic' behaviour"),
+                "The default value is 'true', retaining the 'classic' behaviour. "
+                "The plane gaps take their field from 'Efield', which then needs "
+                "at least three entries, or one per plane if more: TPCs with fewer "
+                "than three planes miss the first induction planes, and the entries "
+                "beyond the last plane of a TPC are ignored"),
         true};
 
       fhicl::Atom<bool> SimpleBoundary{Name("SimpleBoundaryProcess"), Comment("")};
@@ -133,27 +166,110 @@ namespace detinfo {
                                std::set<std::string> const& ignore_params = {});
 
     DetectorPropertiesStandard(DetectorPropertiesStandard const&) = delete;
-    virtual ~DetectorPropertiesStandard() = default;
 
-    void
-    SetNumberTimeSamples(unsigned int nsamp)
-    {
-      fNumberTimeSamples = nsamp;
-    }
+    /// Prints the summary of drift velocity range violations and, if enabled,
+    /// the call statistics (see `ProviderInstrumentation.h`).
+    virtual ~DetectorPropertiesStandard();
+
+    /**
+     * @brief Changes the number of ticks per event.
+     * @param nsamp the new number of ticks per event
+     *
+     * Already created data are not updated. A new, empty set of data is
+     * published (see `SharedDataFor()`), so that later calls of `DataFor()`
+     * return data with the new value.
+     */
+    void SetNumberTimeSamples(unsigned int nsamp);
 
     // Accessors.
 
     double Efield(unsigned int planegap = 0) const override; ///< kV/cm
 
+    /**
+     * @brief Drift velocity [cm/us] for the specified field and temperature.
+     * @param efield electric field [kV/cm], `0` for the configured one
+     * @param temperature argon temperature [K], `0` for the configured one
+     *
+     * Values outside the range of the parameterization (field above 4 kV/cm,
+     * temperature outside 87--94 K) are reported: the configured values are
+     * checked once at configuration, explicit arguments on each call.
+     * Only the first `MaxDriftVelocityRangeWarnings` of each kind are printed;
+     * the others are counted and summarised by
+     * `PrintDriftVelocityRangeSummary()`.
+     *
+     * The velocities for the configured fields (`Efield()` of each plane
+     * gap) at the configured temperature are computed at configuration and
+     * returned from memory; other values are computed at each call by
+     * `ComputeDriftVelocity()`.
+     * This method is thread-safe.
+     */
     double DriftVelocity(double efield = 0.,
                          double temperature = 0.) const override; ///< cm/us
 
+    /**
+     * @brief Drift velocity parameterization [cm/us].
+     * @param efield electric field [kV/cm]
+     * @param temperature argon temperature [K]
+     *
+     * Unlike `DriftVelocity()`, this method does not interpret `0` as the
+     * configured values, does not check the range of the arguments and does
+     * not use the values computed at configuration.
+     */
+    double ComputeDriftVelocity(double efield, double temperature) const;
+
+    /// Prints how many drift velocity requests were out of range, if any.
+    void PrintDriftVelocityRangeSummary() const;
+
+    /// Returns how many drift velocity requests had the field out of range.
+    unsigned long
+    NEfieldOutOfRange() const
+    {
+      return fNEfieldOutOfRange.load(std::memory_order_relaxed);
+    }
+
+    /// Returns how many drift velocity requests had the temperature out of range.
+    unsigned long
+    NTemperatureOutOfRange() const
+    {
+      return fNTemperatureOutOfRange.load(std::memory_order_relaxed);
+    }
+
     /// dQ/dX in electrons/cm, returns dE/dX in MeV/cm.
     double BirksCorrection(double dQdX) const override;
     double BirksCorrection(double dQdX, double EField) const override;
     double ModBoxCorrection(double dQdX) const override;
     double ModBoxCorrection(double dQdX, double EField) const override;
 
+    /// Birks correction for many dQ/dx values, with density and constants hoisted.
+    void BirksCorrection(double const* dQdX, std::size_t n, double* dEdX, double EField)
+      const override;
+    void BirksCorrection(double const* dQdX, std::size_t n, double* dEdX, double const* EField)
+      const override;
+
+    /// Modified box correction for many dQ/dx values, with density and constants hoisted.
+    void ModBoxCorrection(double const* dQdX, std::size_t n, double* dEdX, double EField)
+      const override;
+    void ModBoxCorrection(double const* dQdX, std::size_t n, double* dEdX, double const* EField)
+      const override;
+
+    /// dE/dX in MeV/cm, returns dQ/dX in electrons/cm (inverse of `BirksCorrection()`).
+    double InverseBirksCorrection(double dEdX, double EField) const override;
+    void InverseBirksCorrection(double const* dEdX, std::size_t n, double* dQdX, double EField)
+      const override;
+    void InverseBirksCorrection(double const* dEdX,
+                                std::size_t n,
+                                double* dQdX,
+                                double const* EField) const override;
+
+    /// dE/dX in MeV/cm, returns dQ/dX in electrons/cm (inverse of `ModBoxCorrection()`).
+    double InverseModBoxCorrection(double dEdX, double EField) const override;
+    void InverseModBoxCorrection(double const* dEdX, std::size_t n, double* dQdX, double EField)
+      const override;
+    void InverseModBoxCorrection(double const* dEdX,
+                                 std::size_t n,
+                                 double* dQdX,
+                                 double const* EField) const override;
+
     double
     ElectronLifetime() const override
     {
@@ -192,9 +308,34 @@ namespace detinfo {
      *
      * Based on Bethe-Bloch formula as contained in particle data book.
      * Material parameters are from the configuration.
+     *
+     * If the pair of `mass` and `tcut` is exactly one of those configured in
+     * `ElossTableMasses` and `ElossTableTcuts`, and the momentum is in the
+     * tabulated range, the value is interpolated from a table built at
+     * configuration time, with table nodes at the kinks of the formula and a
+     * relative error from the formula within `ElossTableTolerance` on a dense
+     * sampling (see `detinfo::ElossTable`). Otherwise the result is the one of
+     * `ElossAnalytic()`.
      */
     double Eloss(double mom, double mass, double tcut) const override;
 
+    /**
+     * @brief Restricted mean energy loss (dE/dx), always from the formula.
+     * @see Eloss()
+     *
+     * This is the Bethe-Bloch computation `Eloss()` falls back to and
+     * tabulates; it is exposed to allow validating the tables.
+     */
+    double ElossAnalytic(double mom, double mass, double tcut) const;
+
+    /**
+     * @brief Returns the energy loss table for the specified particle.
+     * @param mass mass of the particle [GeV/c^2]
+     * @param tcut maximum kinetic energy of delta rays [MeV]
+     * @return pointer to the table, `nullptr` if not configured
+     */
+    ElossTable const* ElossTableFor(double mass, double tcut) const;
+
     /**
      * @brief Energy loss fluctuation (@f$ \sigma_{E}^2 / x @f$)
      * @param mom  momentum of incident particle in [GeV/c]
@@ -205,6 +346,25 @@ namespace detinfo {
      */
     double ElossVar(double mom, double mass) const override;
 
+    /**
+     * @brief Restricted mean energy loss for many momenta of one particle.
+     * @see Eloss(double, double, double) const
+     *
+     * Material parameters are fetched once for all the momenta, and the loop
+     * has no function calls but the mathematical ones.
+     */
+    void Eloss(double const* mom,
+               std::size_t n,
+               double* dEdx,
+               double mass,
+               double tcut) const override;
+
+    /**
+     * @brief Energy loss fluctuation for many momenta of one particle.
+     * @see ElossVar(double, double) const
+     */
+    void ElossVar(double const* mom, std::size_t n, double* var, double mass) const override;
+
     double
     ElectronsToADC() const override
     {
@@ -247,8 +407,62 @@ namespace detinfo {
       return fSimpleBoundary;
     }
 
+    /**
+     * @brief Returns the detector properties for the specified clock settings.
+     * @see SharedDataFor()
+     *
+     * The returned object is a copy of the one from `SharedDataFor()`, and
+     * shares its conversion table with it, so it is cheap to obtain after the
+     * first time. The copy is independent of the cached object, but like it
+     * refers to this provider, which must outlive it.
+     */
     DetectorPropertiesData DataFor(detinfo::DetectorClocksData const& clock_data) const override;
 
+    /**
+     * @brief Returns shared detector properties for the specified clock settings.
+     * @param clock_data the clock settings
+     * @return an immutable object with the properties
+     *
+     * The properties depend on the clock settings only via TPC clock period
+     * and trigger offset. The objects for the first `MaxDataCacheSize`
+     * combinations of them are kept, and the same object is returned to all
+     * the callers with the same settings. Jobs usually have very few of them;
+     * the properties for further combinations are computed at each call.
+     *
+     * Concurrency model
+     * ------------------
+     *
+     * This method, and `DataFor()`, can be called concurrently from any
+     * number of threads. The objects already computed are held in an
+     * append-only set, published through an atomic pointer:
+     *
+     * * a reader loads the pointer to the current set and the number of
+     *   entries in it, looks them up and copies the pointer it finds; it
+     *   takes no lock, so readers do not wait for each other nor for a
+     *   computation in progress;
+     * * a thread needing new clock settings computes the properties on its
+     *   own, then, holding a mutex which only writers take, fills the next
+     *   free entry and publishes the new number of entries; once the set is
+     *   full, the properties are returned without taking the mutex;
+     * * each number of time samples has its own set, and
+     *   `SetNumberTimeSamples()` publishes the one of the new value
+     *   (creating it the first time); properties computed with the old value
+     *   are still returned to the threads which requested them, but they are
+     *   not added to the new set.
+     *
+     * The returned pointer always shares the ownership of the object,
+     * whether it is kept in a set or not. The object still refers to this
+     * provider for some of its computations, though, so it must not be used
+     * after the provider is gone. The other configuration of the provider is
+     * constant after construction.
+     */
+    std::shared_ptr<DetectorPropertiesData const> SharedDataFor(
+      detinfo::DetectorClocksData const& clock_data) const;
+
+    /// Number of clock settings whose properties are kept by `SharedDataFor()`
+    /// for each number of time samples.
+    static constexpr std::size_t MaxDataCacheSize = 16U;
+
   private:
     /**
      * @brief Configures the provider, first validating the configuration
@@ -264,6 +478,48 @@ namespace detinfo {
 
     std::string CheckTimeOffsets(std::set<geo::View_t> const& requested_views) const;
 
+    /// Computes the properties for the specified clock settings.
+    DetectorPropertiesData ComputeDataFor(double samplingRate, int triggerOffset) const;
+
+    /// Computes the parts of the x/ticks conversion independent of the clocks.
+    void PrecomputeXTicksTerms();
+
+    /// Warns about the configured field and temperature, if out of range.
+    void CheckDriftVelocityRange() const;
+
+    /// Counts (and maybe reports) a field out of the drift velocity range.
+    void EfieldOutOfRange(double efield) const;
+
+    /// Counts (and maybe reports) a temperature out of the drift velocity range.
+    void TemperatureOutOfRange(double temperature) const;
+
+    /// Material constants used in the energy loss formula.
+    struct ElossConstants_t {
+      double rhoKZ; ///< Density times K times atomic number [MeV cm^2/g].
+      double A;     ///< Atomic mass [g/mol].
+      double I2;    ///< Square of the mean excitation energy [MeV^2].
+    };
+
+    /// Collects the material constants for the energy loss formula.
+    ElossConstants_t ElossConstants() const;
+
+    /// Bethe-Bloch restricted energy loss (dE/dx) with the specified constants.
+    double ElossFormula(double mom, double mass, double tcut, ElossConstants_t const& constants)
+      const;
+
+    /// Bethe-Bloch stopping number, before it is clamped to be at least 1.
+    double ElossStoppingNumber(double bg, double mass, double tcut, double I2) const;
+
+    /// Returns the values of beta gamma where the energy loss formula has a
+    /// kink: thresholds of the density effect correction, switch from the
+    /// maximum delta ray energy to `tcut`, and clamp of the stopping number.
+    std::vector<double> ElossKinks(double mass, double tcut) const;
+
+    /// Tabulates the energy loss for all combinations of masses and cuts.
+    void BuildElossTables(std::vector<double> const& masses,
+                          std::vector<double> const& tcuts,
+                          double tolerance);
+
     /// Parameters for Sternheimer density effect corrections
     struct SternheimerParameters_t {
       double a;    ///< parameter a
@@ -283,7 +539,7 @@ namespace detinfo {
     double fTemperature;             ///< kelvin
     double fElectronsToADC;          ///< conversion factor for # of ionization electrons
                                      ///< to 1 ADC count
-    unsigned int fNumberTimeSamples; ///< number of clock ticks per event
+    std::atomic<unsigned int> fNumberTimeSamples; ///< number of clock ticks per event
     unsigned int fReadOutWindowSize; ///< number of clock ticks per readout window
     double fTimeOffsetU;             ///< time offset to convert spacepoint coordinates to
                                      ///< hit times on view U
@@ -301,6 +557,17 @@ namespace detinfo {
     bool fUseIcarusMicrobooneDriftModel; ///< if true, use alternative ICARUS-MicroBooNE drift
                                          ///< model instead of Walkowiak-based one
 
+    unsigned int fMaxDriftVelocityRangeWarnings; ///< Out-of-range warnings printed per kind.
+
+    /// Number of `DriftVelocity()` calls with the field out of range.
+    mutable std::atomic<unsigned long> fNEfieldOutOfRange{0U};
+    /// Number of `DriftVelocity()` calls with the temperature out of range.
+    mutable std::atomic<unsigned long> fNTemperatureOutOfRange{0U};
+
+    /// Drift velocity [cm/us] at the configured temperature for each configured
+    /// field [kV/cm], as (field, velocity) pairs; constant after configuration.
+    std::vector<std::pair<double, double>> fConfiguredDriftVelocities;
+
     /// Historically, ConvertTicksToX has allowed for the drift time between
     /// the wire planes. This is appropriate for recob::RawDigits, and
     /// recob::Wires from the 1D unfolding, but is not appropriate for
@@ -309,8 +576,56 @@ namespace detinfo {
 
     SternheimerParameters_t fSternheimerParameters; ///< Sternheimer parameters
 
+    /// Energy loss table for a given particle mass and delta ray cut.
+    struct ElossTableEntry_t {
+      double mass; ///< Particle mass [GeV/c^2].
+      double tcut; ///< Maximum delta ray energy [MeV].
+      ElossTable table;
+    };
+
+    std::vector<ElossTableEntry_t> fElossTables; ///< Tabulated energy losses.
+
     std::vector<std::vector<double>> fDriftDirection;
 
+    // x/ticks conversion terms independent of the clocks (see `DataFor()`)
+    XTicksTable fXTicksLayout;               ///< Table with the geometry layout, no values.
+    double fXTicksDriftSpeed;                ///< Drift speed in the main field [cm/ns].
+    std::vector<double> fTPCDriftDirections; ///< Drift direction (+1/-1) of each TPC.
+    std::vector<double> fPlaneDriftTimes;    ///< Drift time to each plane [ns].
+    std::vector<double> fPlaneTickOffsets;   ///< View offset of each plane [ticks].
+
+    /// Clock settings the detector properties depend on.
+    struct DataCacheKey_t {
+      double samplingRate; ///< TPC clock period [ns].
+      int triggerOffset;   ///< Trigger offset [ticks].
+
+      bool
+      operator==(DataCacheKey_t const& other) const
+      {
+        return (samplingRate == other.samplingRate) && (triggerOffset == other.triggerOffset);
+      }
+    };
+
+    /// Append-only set of the detector properties computed for a number of ticks.
+    struct DataSnapshot_t {
+      explicit DataSnapshot_t(unsigned int const nsamp) : numberTimeSamples{nsamp} {}
+
+      unsigned int const numberTimeSamples; ///< Number of ticks the properties are valid for.
+      /// Number of entries published; entries before it are never modified.
+      std::atomic<std::size_t> nEntries{0U};
+      std::array<DataCacheKey_t, MaxDataCacheSize> keys;
+      std::array<std::shared_ptr<DetectorPropertiesData const>, MaxDataCacheSize> data;
+    };
+
+    /// Set of the current number of time samples, owned by `fDataSnapshots`.
+    mutable std::atomic<DataSnapshot_t*> fDataSnapshot{nullptr};
+    /// All the sets ever published; access only with `fDataSnapshotMutex`.
+    mutable std::vector<std::unique_ptr<DataSnapshot_t>> fDataSnapshots;
+    mutable std::mutex fDataSnapshotMutex; ///< Taken only to change the sets.
+
+    /// Publishes the set for `nsamp` time samples; `fDataSnapshotMutex` must be held.
+    void publishDataSnapshot(unsigned int nsamp) const;
+
     bool fSimpleBoundary;
 
   }; // class DetectorPropertiesStandard
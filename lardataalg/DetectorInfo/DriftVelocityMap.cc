@@ -0,0 +1,34 @@
+#include "lardataalg/DetectorInfo/DriftVelocityMap.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
+
+// C/C++ standard libraries
+#include <utility> // std::move()
+
+namespace {
+
+  /// Returns the drift velocity at each node of `efield`, at `temperature`.
+  detinfo::GridMap3D
+  driftVelocityGrid(detinfo::DetectorPropertiesStandard const& properties,
+                    detinfo::GridMap3D const& efield,
+                    double temperature)
+  {
+    if (temperature == 0.) temperature = properties.Temperature();
+    return efield.Transformed([&properties, temperature](double const field) {
+      return (field > 0.) ? properties.ComputeDriftVelocity(field, temperature) : 0.;
+    });
+  }
+
+} // local namespace
+
+detinfo::DriftVelocityMap::DriftVelocityMap(DetectorPropertiesStandard const& properties,
+                                            GridMap3D efieldMap,
+                                            double const temperature)
+  : fEfield{std::move(efieldMap)}
+  , fDriftVelocity{driftVelocityGrid(properties, fEfield, temperature)}
+{}
+
+detinfo::DriftVelocityMap::DriftVelocityMap(DetectorPropertiesStandard const& properties,
+                                            std::string const& efieldMapFile,
+                                            double const temperature)
+  : DriftVelocityMap{properties, GridMap3D::ReadFrom(efieldMapFile), temperature}
+{}
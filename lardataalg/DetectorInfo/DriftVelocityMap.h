@@ -0,0 +1,111 @@
+/**
+ * @file   lardataalg/DetectorInfo/DriftVelocityMap.h
+ * @brief  Position-dependent drift velocity from an electric field map.
+ * @see    lardataalg/DetectorInfo/DriftVelocityMap.cc
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_DRIFTVELOCITYMAP_H
+#define LARDATAALG_DETECTORINFO_DRIFTVELOCITYMAP_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/GridMap3D.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <string>
+
+namespace detinfo {
+
+  class DetectorPropertiesStandard;
+
+  /**
+   * @brief Drift velocity as function of the position, from a field map.
+   *
+   * The electric field magnitude [kV/cm] is given on a regular 3D grid
+   * (`GridMap3D`), typically read from a binary file. On construction, the
+   * drift velocity is computed at each node of the grid with the
+   * `DetectorPropertiesStandard::ComputeDriftVelocity()` parameterization of
+   * the provider, at the specified temperature; the node values are not
+   * subject to the range checks of `DriftVelocity()`. Queries then interpolate the tabulated
+   * velocity: no parameterization is evaluated per point.
+   *
+   * Nodes with no field (zero or negative) have null drift velocity.
+   *
+   * The object does not depend on the provider after construction.
+   */
+  class DriftVelocityMap {
+  public:
+    /**
+     * @brief Builds the map from a field map.
+     * @param properties provider of the drift velocity parameterization
+     * @param efieldMap magnitude of the electric field [kV/cm]
+     * @param temperature argon temperature [K] (`0` for the configured one)
+     */
+    DriftVelocityMap(DetectorPropertiesStandard const& properties,
+                     GridMap3D efieldMap,
+                     double temperature = 0.);
+
+    /**
+     * @brief Builds the map from a field map file.
+     * @param properties provider of the drift velocity parameterization
+     * @param efieldMapFile binary field map file (see `GridMap3D`)
+     * @param temperature argon temperature [K] (`0` for the configured one)
+     */
+    DriftVelocityMap(DetectorPropertiesStandard const& properties,
+                     std::string const& efieldMapFile,
+                     double temperature = 0.);
+
+    /// Returns the electric field at the specified point [kV/cm].
+    double
+    Efield(double const x, double const y, double const z) const noexcept
+    {
+      return fEfield(x, y, z);
+    }
+
+    /// Returns the drift velocity at the specified point [cm/us].
+    double
+    DriftVelocity(double const x, double const y, double const z) const noexcept
+    {
+      return fDriftVelocity(x, y, z);
+    }
+
+    /**
+     * @brief Returns the drift velocity at many points.
+     * @param x pointer to the first of `n` x coordinates [cm]
+     * @param y pointer to the first of `n` y coordinates [cm]
+     * @param z pointer to the first of `n` z coordinates [cm]
+     * @param n number of points
+     * @param vd pointer to the first of the `n` drift velocities [cm/us]
+     */
+    void
+    DriftVelocity(double const* x,
+                  double const* y,
+                  double const* z,
+                  std::size_t const n,
+                  double* vd) const noexcept
+    {
+      fDriftVelocity.Interpolate(x, y, z, n, vd);
+    }
+
+    /// Returns the map of the electric field [kV/cm].
+    GridMap3D const&
+    EfieldMap() const noexcept
+    {
+      return fEfield;
+    }
+
+    /// Returns the map of the drift velocity [cm/us].
+    GridMap3D const&
+    DriftVelocityGrid() const noexcept
+    {
+      return fDriftVelocity;
+    }
+
+  private:
+    GridMap3D fEfield;        ///< Electric field magnitude [kV/cm].
+    GridMap3D fDriftVelocity; ///< Drift velocity at the field map nodes [cm/us].
+  }; // class DriftVelocityMap
+
+} // namespace detinfo
+
+#endif // LARDATAALG_DETECTORINFO_DRIFTVELOCITYMAP_H
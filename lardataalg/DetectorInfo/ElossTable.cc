@@ -0,0 +1,85 @@
+#include "lardataalg/DetectorInfo/ElossTable.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::sort()
+#include <cmath> // std::exp(), std::abs()
+#include <stdexcept> // std::runtime_error, std::invalid_argument
+#include <string>
+
+detinfo::ElossTable::ElossTable(Function_t const& f,
+                                double const minBetaGamma,
+                                double const maxBetaGamma,
+                                std::vector<double> breakpoints,
+                                double const tolerance,
+                                std::size_t const maxNodes)
+  : fMinBetaGamma{minBetaGamma}, fMaxBetaGamma{maxBetaGamma}
+{
+  if ((minBetaGamma <= 0.0) || (maxBetaGamma <= minBetaGamma)) {
+    throw std::invalid_argument("ElossTable: invalid beta gamma range [" +
+                                std::to_string(minBetaGamma) + "; " +
+                                std::to_string(maxBetaGamma) + "]");
+  }
+
+  // the ends of the parts of the range, as logarithms of beta gamma
+  std::sort(breakpoints.begin(), breakpoints.end());
+  std::vector<double> bounds{std::log(minBetaGamma)};
+  for (double const bg : breakpoints) {
+    if ((bg <= minBetaGamma) || (bg >= maxBetaGamma)) continue;
+    double const logBetaGamma = std::log(bg);
+    if (logBetaGamma > bounds.back()) bounds.push_back(logBetaGamma);
+  }
+  bounds.push_back(std::log(maxBetaGamma));
+
+  std::vector<double> values;
+  for (std::size_t iSeg = 0; iSeg < bounds.size() - 1U; ++iSeg) {
+    double const minLog = bounds[iSeg], maxLog = bounds[iSeg + 1];
+
+    // start from one node every 0.1 in log(beta gamma), then double until good
+    std::size_t nNodes = std::max<std::size_t>(16U, 10.0 * (maxLog - minLog) + 1.0);
+    while (true) {
+      auto const [segment, maxRelError] = fill(f, minLog, maxLog, nNodes, values);
+      if (maxRelError <= tolerance) {
+        fSegments.push_back(segment);
+        fSegments.back().first = fValues.size();
+        fValues.insert(fValues.end(), values.begin(), values.end());
+        fMaxRelError = std::max(fMaxRelError, maxRelError);
+        break;
+      }
+      if (nNodes >= maxNodes) {
+        throw std::runtime_error("ElossTable: relative error " + std::to_string(maxRelError) +
+                                 " with " + std::to_string(nNodes) +
+                                 " nodes, still above the tolerance " + std::to_string(tolerance));
+      }
+      nNodes = std::min(2U * nNodes - 1U, maxNodes);
+    } // while
+  }   // for parts of the range
+}
+
+std::pair<detinfo::ElossTable::Segment_t, double>
+detinfo::ElossTable::fill(Function_t const& f,
+                          double const minLog,
+                          double const maxLog,
+                          std::size_t const nNodes,
+                          std::vector<double>& values)
+{
+  double const step = (maxLog - minLog) / (nNodes - 1U);
+  Segment_t const segment{minLog, 1.0 / step, 0U, nNodes};
+
+  values.resize(nNodes);
+  for (std::size_t i = 0; i < nNodes; ++i)
+    values[i] = f(std::exp(minLog + i * step));
+
+  // test the interpolation in between the nodes
+  constexpr unsigned int NSamples = 4U;
+  double maxRelError = 0.0;
+  for (std::size_t i = 0; i < nNodes - 1U; ++i) {
+    for (unsigned int j = 1; j < NSamples; ++j) {
+      double const logBetaGamma = minLog + (i + double(j) / NSamples) * step;
+      double const expected = f(std::exp(logBetaGamma));
+      double const relError =
+        std::abs(interpolate(segment, values.data(), logBetaGamma) / expected - 1.0);
+      maxRelError = std::max(maxRelError, relError);
+    }
+  }
+  return {segment, maxRelError};
+}
@@ -0,0 +1,180 @@
+/**
+ * @file   lardataalg/DetectorInfo/ElossTable.h
+ * @brief  Tabulated energy loss as function of the particle beta gamma.
+ * @see    lardataalg/DetectorInfo/ElossTable.cc
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_ELOSSTABLE_H
+#define LARDATAALG_DETECTORINFO_ELOSSTABLE_H
+
+// C/C++ standard libraries
+#include <cassert>
+#include <cmath> // std::log()
+#include <cstddef> // std::size_t
+#include <functional>
+#include <utility> // std::pair
+#include <vector>
+
+namespace detinfo {
+
+  /**
+   * @brief Energy loss tabulated on uniform grids of @f$ \log(\beta\gamma) @f$.
+   *
+   * The table is filled from a function of @f$ \beta\gamma @f$ only: the mass
+   * of the particle and the cut on the delta ray energy are fixed for each
+   * table.
+   * The value at any point in the covered range is obtained by linear
+   * interpolation between the two closest nodes.
+   *
+   * The range can be split at _breakpoints_, the values of @f$ \beta\gamma @f$
+   * where the function has a kink: each part of the range has its own uniform
+   * grid, with a node at each of its ends, so that no interpolation crosses a
+   * kink.
+   *
+   * On construction, the grid of each part is refined until the interpolation
+   * reproduces the function within the requested relative tolerance on a
+   * sampling four times denser than the grid. This is a sampled error, not a
+   * strict bound, and it is meaningful only if the function is smooth between
+   * the breakpoints. The largest relative deviation found in that sampling is
+   * available as `MaxRelativeError()`.
+   */
+  class ElossTable {
+  public:
+    /// Type of function to be tabulated (argument is beta gamma).
+    using Function_t = std::function<double(double)>;
+
+    /**
+     * @brief Tabulates a function.
+     * @param f the function to tabulate
+     * @param minBetaGamma lower end of the covered range
+     * @param maxBetaGamma upper end of the covered range
+     * @param breakpoints values of beta gamma where `f` has a kink
+     * @param tolerance maximum relative interpolation error
+     * @param maxNodes give up if more than this number of nodes are needed in
+     *                 any part of the range
+     * @throw std::runtime_error if the tolerance is not met with `maxNodes`
+     *
+     * Breakpoints outside the covered range are ignored.
+     */
+    ElossTable(Function_t const& f,
+               double minBetaGamma,
+               double maxBetaGamma,
+               std::vector<double> breakpoints,
+               double tolerance,
+               std::size_t maxNodes = 1U << 20);
+
+    /// Tabulates a function without kinks.
+    ElossTable(Function_t const& f,
+               double minBetaGamma,
+               double maxBetaGamma,
+               double tolerance,
+               std::size_t maxNodes = 1U << 20)
+      : ElossTable{f, minBetaGamma, maxBetaGamma, {}, tolerance, maxNodes}
+    {}
+
+    /// Returns whether the specified beta gamma is in the tabulated range.
+    bool
+    Covers(double const betaGamma) const noexcept
+    {
+      return (betaGamma >= fMinBetaGamma) && (betaGamma <= fMaxBetaGamma);
+    }
+
+    /// Returns the interpolated value for `betaGamma` (must be `Covers()`).
+    double
+    operator()(double const betaGamma) const noexcept
+    {
+      assert(Covers(betaGamma));
+      return interpolate(std::log(betaGamma));
+    }
+
+    /// Returns the largest relative interpolation error found at construction.
+    double
+    MaxRelativeError() const noexcept
+    {
+      return fMaxRelError;
+    }
+
+    /// Returns the number of nodes in the table.
+    std::size_t
+    NNodes() const noexcept
+    {
+      return fValues.size();
+    }
+
+    double
+    MinBetaGamma() const noexcept
+    {
+      return fMinBetaGamma;
+    }
+    double
+    MaxBetaGamma() const noexcept
+    {
+      return fMaxBetaGamma;
+    }
+
+    /// Returns the number of parts of the range with a separate grid.
+    std::size_t
+    NSegments() const noexcept
+    {
+      return fSegments.size();
+    }
+
+  private:
+    /// Part of the range tabulated with a uniform grid.
+    struct Segment_t {
+      double minLog;      ///< Logarithm of beta gamma at the first node.
+      double nodesPerLog; ///< Inverse of the node spacing.
+      std::size_t first;  ///< Index of the first node in `fValues`.
+      std::size_t nNodes; ///< Number of nodes.
+    };
+
+    double fMinBetaGamma;             ///< Lower end of the covered range.
+    double fMaxBetaGamma;             ///< Upper end of the covered range.
+    double fMaxRelError = 0.0;        ///< Largest relative error found.
+    std::vector<Segment_t> fSegments; ///< Parts of the range, in order.
+    std::vector<double> fValues;      ///< Tabulated values of all the parts.
+
+    /**
+     * @brief Tabulates `f` with `nNodes` nodes between two logarithms.
+     * @param f the function to tabulate
+     * @param minLog logarithm of beta gamma at the first node
+     * @param maxLog logarithm of beta gamma at the last node
+     * @param nNodes number of nodes
+     * @param[out] values tabulated values
+     * @return the description of the grid, and the largest relative error
+     */
+    static std::pair<Segment_t, double> fill(Function_t const& f,
+                                             double minLog,
+                                             double maxLog,
+                                             std::size_t nNodes,
+                                             std::vector<double>& values);
+
+    /// Returns the interpolated value at the specified logarithm of beta gamma.
+    double
+    interpolate(double const logBetaGamma) const noexcept
+    {
+      std::size_t s = fSegments.size() - 1U;
+      while ((s > 0U) && (logBetaGamma < fSegments[s].minLog))
+        --s;
+      Segment_t const& segment = fSegments[s];
+      return interpolate(segment, fValues.data() + segment.first, logBetaGamma);
+    }
+
+    /// Returns the value interpolated from the `values` of a grid.
+    static double
+    interpolate(Segment_t const& segment,
+                double const* values,
+                double const logBetaGamma) noexcept
+    {
+      double const pos = (logBetaGamma - segment.minLog) * segment.nodesPerLog;
+      std::size_t i = static_cast<std::size_t>(pos);
+      if (i >= segment.nNodes - 1U) i = segment.nNodes - 2U; // upper edge
+      double const w = pos - i;
+      return values[i] + w * (values[i + 1] - values[i]);
+    }
+
+  }; // class ElossTable
+
+} // namespace detinfo
+
+#endif // LARDATAALG_DETECTORINFO_ELOSSTABLE_H
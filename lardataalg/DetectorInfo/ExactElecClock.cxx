@@ -0,0 +1,57 @@
+#include "ExactElecClock.h"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+
+  /// Largest denominator accepted for the clock frequency.
+  constexpr detinfo::ExactElecClock::tick_t MaxFrequencyDenominator = 1 << 20;
+
+  /// Relative tolerance for a value to be considered exactly represented.
+  constexpr double Tolerance = 1e-12;
+
+  bool
+  closeTo(double const value, double const target)
+  {
+    return std::abs(value - target) <= Tolerance * std::abs(target);
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+detinfo::ExactElecClock
+detinfo::ExactElecClock::FromElecClock(ElecClock const& clock)
+{
+  double const frequency = clock.Frequency();
+  if (!(frequency > 0.0))
+    throw detinfo::DetectorClocksException("Only positive frequency allowed.");
+
+  // continued fraction expansion of the frequency, until it matches
+  tick_t num = 1, den = 0, prevNum = 0, prevDen = 1;
+  double rest = frequency;
+  while (den == 0 || !closeTo(static_cast<double>(num) / den, frequency)) {
+    double const a = std::floor(rest);
+    if (a > static_cast<double>(std::numeric_limits<tick_t>::max() / 2))
+      throw detinfo::DetectorClocksException("Clock frequency is too large.");
+    tick_t const term = static_cast<tick_t>(a);
+    tick_t const nextNum = term * num + prevNum;
+    tick_t const nextDen = term * den + prevDen;
+    if (nextDen > MaxFrequencyDenominator)
+      throw detinfo::DetectorClocksException("Clock frequency is not a simple fraction.");
+    prevNum = num;
+    prevDen = den;
+    num = nextNum;
+    den = nextDen;
+    if (rest == a) break;
+    rest = 1.0 / (rest - a);
+  }
+
+  double const frameTicks = clock.FramePeriod() * num / den;
+  if (!(frameTicks >= 1.0) || (frameTicks > static_cast<double>(tick_t{1} << 53)) ||
+      !closeTo(std::round(frameTicks), frameTicks))
+    throw detinfo::DetectorClocksException("Frame period is not a whole number of ticks.");
+
+  ExactElecClock const exact{0, static_cast<tick_t>(std::round(frameTicks)), num, den};
+  return exact.WithTime(clock.Time());
+}
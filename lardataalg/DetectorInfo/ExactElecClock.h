@@ -0,0 +1,344 @@
+/**
+ * \file ExactElecClock.h
+ *
+ * \ingroup DetectorClocks
+ *
+ * \brief Class def header for a class ExactElecClock
+ */
+
+/** \addtogroup DetectorClocks
+
+    @{*/
+#ifndef ExactElecClock_H
+#define ExactElecClock_H
+
+#include "DetectorClocksException.h"
+#include "ElecClock.h"
+
+#include <cmath>
+#include <cstdint>
+#include <new>
+#include <numeric>
+
+namespace detinfo {
+  /**
+   * @brief Electronics clock with integer tick arithmetic.
+   *
+   * This class is a counterpart of `ElecClock` which stores the state of the
+   * clock as integer numbers rather than as a time:
+   *
+   * * _frame_ and _sample_ the clock is at, as 64-bit integers; the sample is
+   *   always in the range `[ 0, FrameTicks() [`
+   * * _frame ticks_: number of ticks in a frame
+   * * _tick frequency_, as an exact rational number of ticks per microsecond
+   *
+   * Frame, sample and tick numbers of the clock (`Frame()`, `Sample()`,
+   * `Ticks()`) and the conversions between ticks and sample/frame pairs are
+   * exact. The current frame and sample are kept up to date when the clock
+   * advances, so that querying them needs no division.
+   *
+   * Floating point numbers appear only at the edges: times are converted into
+   * ticks by `TickAt()`, `WithTime()` and friends, and ticks are converted
+   * back into times by `Time()`, which performs a single rounding.
+   * Tick, sample and frame numbers of negative times are rounded down, so that
+   * the sample number is never negative (`ElecClock` truncates toward zero
+   * instead).
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * // 31.25 MHz clock with 50000 ticks per frame, at tick 0
+   * detinfo::ExactElecClock clock(0, 50000, 125, 4);
+   *
+   * clock = clock.AdvanceTicksBy(123456);
+   * std::cout << clock.Frame() << " " << clock.Sample() // 2 23456
+   *   << " " << clock.Time() << std::endl;            // 3950.592 us
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * A clock can be converted from and into an `ElecClock` by `FromElecClock()`
+   * and `ToElecClock()`.
+   */
+  class ExactElecClock {
+  public:
+    using tick_t = std::int64_t; ///< Type of tick, sample and frame numbers.
+
+    /**
+     * @brief Constructor: sets all values.
+     * @param ticks current tick of the clock
+     * @param frame_ticks number of ticks in a frame
+     * @param frequency_num numerator of the clock frequency [MHz]
+     * @param frequency_den denominator of the clock frequency [MHz]
+     * @throw DetectorClocksException if any of the parameters but `ticks` is
+     *        not positive
+     */
+    ExactElecClock(tick_t const ticks,
+                   tick_t const frame_ticks,
+                   tick_t const frequency_num,
+                   tick_t const frequency_den = 1)
+      : ExactElecClock{ticks,
+                       checkedFrameTicks(frame_ticks, frequency_num, frequency_den),
+                       frequency_num,
+                       frequency_den,
+                       std::nothrow}
+    {}
+
+    /**
+     * @brief Returns an exact clock equivalent to `clock`.
+     * @param clock the floating point clock to be converted
+     * @return an exact clock at the tick `clock.Ticks()` falls in
+     * @throw DetectorClocksException if the frequency is not a rational number
+     *        with a small denominator, or a frame is not an integral number of
+     *        ticks
+     */
+    static ExactElecClock FromElecClock(ElecClock const& clock);
+
+    /// Returns a floating point clock at the start of the current tick.
+    ElecClock
+    ToElecClock() const
+    {
+      return {Time(), FramePeriod(), Frequency()};
+    }
+
+    constexpr ExactElecClock
+    WithTick(tick_t const tick) const noexcept
+    {
+      return {tick, fFrameTicks, fFrequencyNum, fFrequencyDen, std::nothrow};
+    }
+
+    constexpr ExactElecClock
+    WithTick(tick_t const sample, tick_t const frame) const noexcept
+    {
+      return WithTick(Ticks(sample, frame));
+    }
+
+    /// Returns a clock at the tick the specified time [&micro;s] falls in.
+    ExactElecClock
+    WithTime(double const time) const noexcept
+    {
+      return WithTick(TickAt(time));
+    }
+
+    constexpr ExactElecClock
+    AdvanceTicksBy(tick_t const ticks) const noexcept
+    {
+      ExactElecClock clock{*this};
+      clock.fSample += ticks;
+      if ((clock.fSample < 0) || (clock.fSample >= fFrameTicks)) {
+        clock.fFrame += floorDiv(clock.fSample, fFrameTicks);
+        clock.fSample = floorMod(clock.fSample, fFrameTicks);
+      }
+      return clock;
+    }
+
+    /// Current clock tick.
+    constexpr tick_t
+    Ticks() const noexcept
+    {
+      return Ticks(fSample, fFrame);
+    }
+
+    /// Returns the tick of the specified sample within the specified frame.
+    constexpr tick_t
+    Ticks(tick_t const sample, tick_t const frame) const noexcept
+    {
+      return frame * fFrameTicks + sample;
+    }
+
+    /// Number of sample within the current frame.
+    constexpr tick_t
+    Sample() const noexcept
+    {
+      return fSample;
+    }
+
+    /// Returns the number of the sample of `tick` within its frame.
+    constexpr tick_t
+    Sample(tick_t const tick) const noexcept
+    {
+      return floorMod(tick, fFrameTicks);
+    }
+
+    /// Number of the current frame.
+    constexpr tick_t
+    Frame() const noexcept
+    {
+      return fFrame;
+    }
+
+    /// Returns the number of the frame `tick` belongs to.
+    constexpr tick_t
+    Frame(tick_t const tick) const noexcept
+    {
+      return floorDiv(tick, fFrameTicks);
+    }
+
+    /// Number of ticks in a frame.
+    constexpr tick_t
+    FrameTicks() const noexcept
+    {
+      return fFrameTicks;
+    }
+
+    /// Numerator of the frequency [MHz], in lowest terms.
+    constexpr tick_t
+    FrequencyNumerator() const noexcept
+    {
+      return fFrequencyNum;
+    }
+
+    /// Denominator of the frequency [MHz], in lowest terms.
+    constexpr tick_t
+    FrequencyDenominator() const noexcept
+    {
+      return fFrequencyDen;
+    }
+
+    //-- conversions from and to time --//
+
+    /// Returns the number of the tick the specified time [&micro;s] falls in.
+    tick_t
+    TickAt(double const time) const noexcept
+    {
+      return static_cast<tick_t>(std::floor(time * fFrequencyNum / fFrequencyDen));
+    }
+
+    /// Returns the number of the sample the specified time [&micro;s] falls in.
+    tick_t
+    SampleAt(double const time) const noexcept
+    {
+      return Sample(TickAt(time));
+    }
+
+    /// Returns the number of the frame the specified time [&micro;s] falls in.
+    tick_t
+    FrameAt(double const time) const noexcept
+    {
+      return Frame(TickAt(time));
+    }
+
+    /// Start time of the current tick [&micro;s].
+    constexpr double
+    Time() const noexcept
+    {
+      return Time(Ticks());
+    }
+
+    /// Returns the start time of the specified tick [&micro;s].
+    constexpr double
+    Time(tick_t const tick) const noexcept
+    {
+      return static_cast<double>(tick * fFrequencyDen) / fFrequencyNum;
+    }
+
+    /// Returns the start time of the specified sample and frame [&micro;s].
+    constexpr double
+    Time(tick_t const sample, tick_t const frame) const noexcept
+    {
+      return Time(Ticks(sample, frame));
+    }
+
+    /// Frequency in MHz.
+    constexpr double
+    Frequency() const noexcept
+    {
+      return static_cast<double>(fFrequencyNum) / fFrequencyDen;
+    }
+
+    /// A single frame period in microseconds.
+    constexpr double
+    FramePeriod() const noexcept
+    {
+      return Time(fFrameTicks);
+    }
+
+    /// A single tick period in microseconds.
+    constexpr double
+    TickPeriod() const noexcept
+    {
+      return static_cast<double>(fFrequencyDen) / fFrequencyNum;
+    }
+
+    //-- comparators --//
+
+    constexpr bool
+    operator==(ExactElecClock const& rhs) const noexcept
+    {
+      return Ticks() == rhs.Ticks();
+    }
+    constexpr bool
+    operator!=(ExactElecClock const& rhs) const noexcept
+    {
+      return Ticks() != rhs.Ticks();
+    }
+    constexpr bool
+    operator<(ExactElecClock const& rhs) const noexcept
+    {
+      return Ticks() < rhs.Ticks();
+    }
+    constexpr bool
+    operator>(ExactElecClock const& rhs) const noexcept
+    {
+      return Ticks() > rhs.Ticks();
+    }
+    constexpr bool
+    operator<=(ExactElecClock const& rhs) const noexcept
+    {
+      return Ticks() <= rhs.Ticks();
+    }
+    constexpr bool
+    operator>=(ExactElecClock const& rhs) const noexcept
+    {
+      return Ticks() >= rhs.Ticks();
+    }
+
+  private:
+    constexpr ExactElecClock(tick_t const ticks,
+                             tick_t const frame_ticks,
+                             tick_t const frequency_num,
+                             tick_t const frequency_den,
+                             std::nothrow_t) noexcept
+      : fFrame(floorDiv(ticks, frame_ticks))
+      , fSample(floorMod(ticks, frame_ticks))
+      , fFrameTicks(frame_ticks)
+      , fFrequencyNum(frequency_num / std::gcd(frequency_num, frequency_den))
+      , fFrequencyDen(frequency_den / std::gcd(frequency_num, frequency_den))
+    {}
+
+    /// Returns `frame_ticks` after checking all the parameters are positive.
+    static tick_t
+    checkedFrameTicks(tick_t const frame_ticks,
+                      tick_t const frequency_num,
+                      tick_t const frequency_den)
+    {
+      if (frame_ticks <= 0)
+        throw detinfo::DetectorClocksException("Only positive frame ticks allowed.");
+      if ((frequency_num <= 0) || (frequency_den <= 0))
+        throw detinfo::DetectorClocksException("Only positive frequency allowed.");
+      return frame_ticks;
+    }
+
+    /// Integer division rounding toward negative infinity.
+    static constexpr tick_t
+    floorDiv(tick_t const a, tick_t const b) noexcept
+    {
+      tick_t const q = a / b;
+      return ((a % b != 0) && ((a < 0) != (b < 0))) ? q - 1 : q;
+    }
+
+    /// Remainder of `floorDiv()`, with the same sign as `b`.
+    static constexpr tick_t
+    floorMod(tick_t const a, tick_t const b) noexcept
+    {
+      return a - floorDiv(a, b) * b;
+    }
+
+    tick_t fFrame;        ///< Current frame.
+    tick_t fSample;       ///< Current sample within the frame.
+    tick_t fFrameTicks;   ///< Ticks in a frame.
+    tick_t fFrequencyNum; ///< Numerator of the clock speed in MHz.
+    tick_t fFrequencyDen; ///< Denominator of the clock speed in MHz.
+
+  }; // class ExactElecClock
+
+}
+#endif
+/** @} */ // end of doxygen group
@@ -0,0 +1,169 @@
+/**
+ * @file   lardataalg/DetectorInfo/FixedXTicksTable.h
+ * @brief  Drift coordinate/TPC tick conversions for a layout known at compile time.
+ * @see    lardataalg/DetectorInfo/XTicksTable.h
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_FIXEDXTICKSTABLE_H
+#define LARDATAALG_DETECTORINFO_FIXEDXTICKSTABLE_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <stdexcept> // std::length_error
+#include <string>
+
+namespace detinfo {
+
+  /**
+   * @brief Conversion parameters between drift coordinate and TPC ticks, with
+   *        fixed size storage.
+   * @tparam MaxPlanes maximum number of planes in a TPC
+   * @tparam MaxTPCs maximum number of TPCs in a cryostat
+   * @tparam MaxCryostats maximum number of cryostats
+   *
+   * This is a copy of a `XTicksTable` in `std::array` storage with sizes
+   * known at compile time: the position of each parameter is computed with
+   * constant strides and there is no indirection to heap memory.
+   * The conversions give the same results as the ones of `XTicksTable`.
+   *
+   * Elements for planes, TPCs and cryostats not present in the source table
+   * are null. Access to them is only checked by assertions.
+   */
+  template <unsigned int MaxPlanes, unsigned int MaxTPCs, unsigned int MaxCryostats = 1U>
+  class FixedXTicksTable {
+    static_assert(MaxPlanes > 0U && MaxTPCs > 0U && MaxCryostats > 0U,
+                  "FixedXTicksTable needs at least one plane, TPC and cryostat");
+
+  public:
+    /**
+     * @brief Copies the parameters from a table.
+     * @param table the table to copy from
+     * @throw std::length_error if `table` has more elements than this can hold
+     */
+    explicit FixedXTicksTable(XTicksTable const& table);
+
+    /// Returns whether the specified plane is present.
+    bool
+    HasPlane(unsigned int const p, unsigned int const t, unsigned int const c) const noexcept
+    {
+      return (c < MaxCryostats) && (t < MaxTPCs) && (p < fNPlanes[c][t]);
+    }
+
+    /// Returns the conversion coefficient, including the drift direction [cm/tick].
+    double
+    Coefficient(unsigned int const t, unsigned int const c) const noexcept
+    {
+      return fCmPerTick[c][t];
+    }
+
+    /// Returns the tick offset of plane `p` in TPC `t` of cryostat `c`.
+    double
+    Offset(unsigned int const p, unsigned int const t, unsigned int const c) const noexcept
+    {
+      assert(HasPlane(p, t, c));
+      return fOffsets[c][t][p];
+    }
+
+    /// Converts drift coordinate `x` [cm] into ticks on the specified plane.
+    double
+    XToTicks(double const x, unsigned int const p, unsigned int const t, unsigned int const c) const
+      noexcept
+    {
+      assert(HasPlane(p, t, c));
+      return x * fTicksPerCm[c][t] + fOffsets[c][t][p];
+    }
+
+    /// Converts `ticks` on the specified plane into drift coordinate [cm].
+    double
+    TicksToX(double const ticks, unsigned int const p, unsigned int const t, unsigned int const c)
+      const noexcept
+    {
+      assert(HasPlane(p, t, c));
+      return (ticks - fOffsets[c][t][p]) * fCmPerTick[c][t];
+    }
+
+    /// Converts `n` drift coordinates [cm] into ticks on the specified plane.
+    void
+    XToTicks(double const* x,
+             std::size_t const n,
+             double* ticks,
+             unsigned int const p,
+             unsigned int const t,
+             unsigned int const c) const noexcept
+    {
+      assert(HasPlane(p, t, c));
+      double const ticksPerCm = fTicksPerCm[c][t];
+      double const offset = fOffsets[c][t][p];
+      for (std::size_t i = 0; i < n; ++i)
+        ticks[i] = x[i] * ticksPerCm + offset;
+    }
+
+    /// Converts `n` ticks on the specified plane into drift coordinates [cm].
+    void
+    TicksToX(double const* ticks,
+             std::size_t const n,
+             double* x,
+             unsigned int const p,
+             unsigned int const t,
+             unsigned int const c) const noexcept
+    {
+      assert(HasPlane(p, t, c));
+      double const cmPerTick = fCmPerTick[c][t];
+      double const offset = fOffsets[c][t][p];
+      for (std::size_t i = 0; i < n; ++i)
+        x[i] = (ticks[i] - offset) * cmPerTick;
+    }
+
+  private:
+    template <typename T>
+    using PerTPC_t = std::array<std::array<T, MaxTPCs>, MaxCryostats>;
+
+    PerTPC_t<double> fTicksPerCm{};                     ///< Inverse coefficients.
+    PerTPC_t<double> fCmPerTick{};                      ///< Coefficients.
+    PerTPC_t<std::array<double, MaxPlanes>> fOffsets{}; ///< Plane tick offsets.
+    PerTPC_t<unsigned int> fNPlanes{};                  ///< Planes in each TPC.
+
+  }; // class FixedXTicksTable
+
+} // namespace detinfo
+
+//------------------------------------------------------------------------------
+template <unsigned int MaxPlanes, unsigned int MaxTPCs, unsigned int MaxCryostats>
+detinfo::FixedXTicksTable<MaxPlanes, MaxTPCs, MaxCryostats>::FixedXTicksTable(
+  XTicksTable const& table)
+{
+  if (table.NCryostats() > MaxCryostats) {
+    throw std::length_error("FixedXTicksTable: " + std::to_string(table.NCryostats()) +
+                            " cryostats, only " + std::to_string(MaxCryostats) + " supported");
+  }
+  for (unsigned int c = 0; c < table.NCryostats(); ++c) {
+    if (table.NTPCs(c) > MaxTPCs) {
+      throw std::length_error("FixedXTicksTable: " + std::to_string(table.NTPCs(c)) +
+                              " TPCs in cryostat " + std::to_string(c) + ", only " +
+                              std::to_string(MaxTPCs) + " supported");
+    }
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t) {
+      unsigned int const nPlanes = table.NPlanes(t, c);
+      if (nPlanes > MaxPlanes) {
+        throw std::length_error("FixedXTicksTable: " + std::to_string(nPlanes) +
+                                " planes in C:" + std::to_string(c) + " T:" + std::to_string(t) +
+                                ", only " + std::to_string(MaxPlanes) + " supported");
+      }
+      double const* row = table.Row(t, c);
+      fTicksPerCm[c][t] = row[0];
+      fCmPerTick[c][t] = row[1];
+      fNPlanes[c][t] = nPlanes;
+      for (unsigned int p = 0; p < nPlanes; ++p)
+        fOffsets[c][t][p] = table.Offset(p, t, c);
+    } // for TPCs
+  }   // for cryostats
+}
+
+#endif // LARDATAALG_DETECTORINFO_FIXEDXTICKSTABLE_H
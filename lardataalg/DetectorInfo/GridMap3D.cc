@@ -0,0 +1,180 @@
+#include "lardataalg/DetectorInfo/GridMap3D.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::clamp(), std::min()
+#include <cstdint>   // std::uint32_t
+#include <cstring>   // std::memcmp()
+#include <fstream>
+#include <limits>    // std::numeric_limits<>
+#include <stdexcept> // std::invalid_argument, std::runtime_error
+
+namespace {
+
+  constexpr char FileMagic[8] = {'G', 'R', 'I', 'D', 'M', 'A', 'P', '3'};
+  constexpr std::uint32_t FileVersion = 1U;
+
+} // local namespace
+
+detinfo::GridMap3D::GridMap3D(Size_t const& nNodes,
+                              Vector_t const& origin,
+                              Vector_t const& spacing,
+                              std::vector<double> const& values)
+  : fNNodes{nNodes}, fOrigin{origin}, fSpacing{spacing}
+{
+  std::size_t nValues = 1U;
+  for (unsigned int axis = 0; axis < 3U; ++axis) {
+    if (fNNodes[axis] < 2U)
+      throw std::invalid_argument("GridMap3D: at least two nodes per axis are needed");
+    if (!(fSpacing[axis] > 0.0))
+      throw std::invalid_argument("GridMap3D: node spacing must be positive");
+    fNBlocks[axis] = (fNNodes[axis] + BlockSize - 1U) / BlockSize;
+    fInverseSpacing[axis] = 1.0 / fSpacing[axis];
+    nValues *= fNNodes[axis];
+  }
+  if (values.size() != nValues) {
+    throw std::invalid_argument("GridMap3D: " + std::to_string(values.size()) +
+                                " values for " + std::to_string(nValues) + " nodes");
+  }
+
+  fValues.assign(std::size_t(fNBlocks[0]) * fNBlocks[1] * fNBlocks[2] *
+                   (BlockSize * BlockSize * BlockSize),
+                 0.0);
+  auto iValue = values.begin();
+  for (unsigned int k = 0; k < fNNodes[2]; ++k)
+    for (unsigned int j = 0; j < fNNodes[1]; ++j)
+      for (unsigned int i = 0; i < fNNodes[0]; ++i)
+        fValues[storageIndex(i, j, k)] = *(iValue++);
+}
+
+detinfo::GridMap3D
+detinfo::GridMap3D::ReadFrom(std::string const& fileName)
+{
+  std::ifstream file{fileName, std::ios::binary};
+  if (!file) throw std::runtime_error("GridMap3D: can't open '" + fileName + "'");
+
+  char magic[sizeof(FileMagic)];
+  std::uint32_t version = 0U;
+  std::uint32_t n[3];
+  Vector_t origin, spacing;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  if (!file || std::memcmp(magic, FileMagic, sizeof(magic)) != 0 || version != FileVersion) {
+    throw std::runtime_error("GridMap3D: '" + fileName + "' is not a version " +
+                             std::to_string(FileVersion) + " grid map file");
+  }
+  file.read(reinterpret_cast<char*>(n), sizeof(n));
+  file.read(reinterpret_cast<char*>(origin.data()), sizeof(double) * origin.size());
+  file.read(reinterpret_cast<char*>(spacing.data()), sizeof(double) * spacing.size());
+  if (!file) throw std::runtime_error("GridMap3D: '" + fileName + "' is truncated");
+
+  // validate the header before allocating anything
+  std::size_t nValues = 1U;
+  for (unsigned int axis = 0; axis < 3U; ++axis) {
+    if (n[axis] < 2U || !(spacing[axis] > 0.0)) {
+      throw std::runtime_error("GridMap3D: '" + fileName +
+                               "' has an invalid grid (at least two nodes per axis and"
+                               " positive spacing are needed)");
+    }
+    if (nValues > std::numeric_limits<std::size_t>::max() / sizeof(double) / n[axis]) {
+      throw std::runtime_error("GridMap3D: '" + fileName + "' has too many nodes");
+    }
+    nValues *= n[axis];
+  }
+
+  std::streampos const dataStart = file.tellg();
+  file.seekg(0, std::ios::end);
+  std::streamoff const dataSize = file.tellg() - dataStart;
+  file.seekg(dataStart);
+  if (!file || dataSize < 0 || static_cast<std::size_t>(dataSize) != sizeof(double) * nValues) {
+    throw std::runtime_error("GridMap3D: '" + fileName + "' should hold " +
+                             std::to_string(nValues) + " values after the header, but has " +
+                             std::to_string(dataSize) + " bytes");
+  }
+
+  std::vector<double> values(nValues);
+  file.read(reinterpret_cast<char*>(values.data()), sizeof(double) * values.size());
+  if (!file) throw std::runtime_error("GridMap3D: error reading '" + fileName + "'");
+
+  return {{n[0], n[1], n[2]}, origin, spacing, values};
+}
+
+void
+detinfo::GridMap3D::WriteTo(std::string const& fileName) const
+{
+  std::ofstream file{fileName, std::ios::binary};
+  if (!file) throw std::runtime_error("GridMap3D: can't create '" + fileName + "'");
+
+  std::uint32_t const n[3] = {fNNodes[0], fNNodes[1], fNNodes[2]};
+  file.write(FileMagic, sizeof(FileMagic));
+  file.write(reinterpret_cast<char const*>(&FileVersion), sizeof(FileVersion));
+  file.write(reinterpret_cast<char const*>(n), sizeof(n));
+  file.write(reinterpret_cast<char const*>(fOrigin.data()), sizeof(double) * fOrigin.size());
+  file.write(reinterpret_cast<char const*>(fSpacing.data()), sizeof(double) * fSpacing.size());
+  for (unsigned int k = 0; k < fNNodes[2]; ++k) {
+    for (unsigned int j = 0; j < fNNodes[1]; ++j) {
+      for (unsigned int i = 0; i < fNNodes[0]; ++i) {
+        double const value = NodeValue(i, j, k);
+        file.write(reinterpret_cast<char const*>(&value), sizeof(value));
+      }
+    }
+  }
+  if (!file) throw std::runtime_error("GridMap3D: error writing '" + fileName + "'");
+}
+
+detinfo::GridMap3D
+detinfo::GridMap3D::Transformed(std::function<double(double)> const& f) const
+{
+  GridMap3D result{*this};
+  for (double& value : result.fValues)
+    value = f(value);
+  return result;
+}
+
+double
+detinfo::GridMap3D::operator()(double const x, double const y, double const z) const noexcept
+{
+  double value;
+  Interpolate(&x, &y, &z, 1U, &value);
+  return value;
+}
+
+void
+detinfo::GridMap3D::Interpolate(double const* x,
+                                double const* y,
+                                double const* z,
+                                std::size_t const n,
+                                double* values) const noexcept
+{
+  for (std::size_t iPoint = 0; iPoint < n; ++iPoint) {
+    unsigned int i, j, k;
+    double fx, fy, fz;
+    locate(0U, x[iPoint], i, fx);
+    locate(1U, y[iPoint], j, fy);
+    locate(2U, z[iPoint], k, fz);
+
+    // interpolate along x, then y, then z
+    double const v00 = NodeValue(i, j, k) + fx * (NodeValue(i + 1, j, k) - NodeValue(i, j, k));
+    double const v10 =
+      NodeValue(i, j + 1, k) + fx * (NodeValue(i + 1, j + 1, k) - NodeValue(i, j + 1, k));
+    double const v01 =
+      NodeValue(i, j, k + 1) + fx * (NodeValue(i + 1, j, k + 1) - NodeValue(i, j, k + 1));
+    double const v11 = NodeValue(i, j + 1, k + 1) +
+                       fx * (NodeValue(i + 1, j + 1, k + 1) - NodeValue(i, j + 1, k + 1));
+    double const v0 = v00 + fy * (v10 - v00);
+    double const v1 = v01 + fy * (v11 - v01);
+    values[iPoint] = v0 + fz * (v1 - v0);
+  }
+}
+
+void
+detinfo::GridMap3D::locate(unsigned int const axis,
+                           double const pos,
+                           unsigned int& index,
+                           double& fraction) const noexcept
+{
+  // points outside the grid are moved on its border
+  double const u = std::clamp(
+    (pos - fOrigin[axis]) * fInverseSpacing[axis], 0.0, static_cast<double>(fNNodes[axis] - 1U));
+  index = std::min(static_cast<unsigned int>(u), fNNodes[axis] - 2U);
+  fraction = u - index;
+}
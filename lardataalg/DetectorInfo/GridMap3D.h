@@ -0,0 +1,160 @@
+/**
+ * @file   lardataalg/DetectorInfo/GridMap3D.h
+ * @brief  Scalar quantity sampled on a regular 3D grid.
+ * @see    lardataalg/DetectorInfo/GridMap3D.cc
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_GRIDMAP3D_H
+#define LARDATAALG_DETECTORINFO_GRIDMAP3D_H
+
+// LArSoft libraries
+#include "lardataalg/Utilities/AlignedAllocator.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace detinfo {
+
+  /**
+   * @brief A scalar quantity sampled on a regular 3D grid.
+   *
+   * The grid has `N[0] x N[1] x N[2]` nodes, the first one at `Origin()` and
+   * the others spaced by `Spacing()` along each axis. The value at any point
+   * is obtained by trilinear interpolation of the eight nodes around it;
+   * points outside the grid get the value of the closest point on its border.
+   *
+   * The values are stored in cubic blocks of `BlockSize` nodes per side, each
+   * block contiguous in memory (512 bytes, eight 64-byte cache lines) and
+   * aligned to a cache line. The eight nodes of an interpolation cell are in
+   * the same block for 27 of the 64 cells with their first node in a block;
+   * the nodes of those cells lie in two or four cache lines, while the other
+   * cells span two, four or eight neighbouring blocks.
+   *
+   * Binary file format
+   * -------------------
+   *
+   * All numbers are in the native byte order:
+   * * 8 characters: `GRIDMAP3`
+   * * 32-bit unsigned integer: format version (`1`)
+   * * three 32-bit unsigned integers: number of nodes along x, y and z
+   * * three `double`: coordinates of the first node
+   * * three `double`: spacing of the nodes along x, y and z
+   * * `double` values of all the nodes, x index running fastest, then y, z.
+   *
+   * `ReadFrom()` rejects files with fewer than two nodes or a non-positive
+   * spacing along any axis, and files whose size does not match the number of
+   * nodes in their header.
+   */
+  class GridMap3D {
+  public:
+    /// Nodes per side of a storage block.
+    static constexpr unsigned int BlockSize = 4U;
+
+    /// Type of a triplet of coordinates or spacings.
+    using Vector_t = std::array<double, 3U>;
+
+    /// Type of a triplet of node counts.
+    using Size_t = std::array<unsigned int, 3U>;
+
+    /**
+     * @brief Creates a map from the values of its nodes.
+     * @param nNodes number of nodes along x, y and z (at least 2 each)
+     * @param origin coordinates of the first node
+     * @param spacing distance between nodes along x, y and z (positive)
+     * @param values node values, x index running fastest, then y, z
+     * @throw std::invalid_argument if the arguments are not consistent
+     */
+    GridMap3D(Size_t const& nNodes,
+              Vector_t const& origin,
+              Vector_t const& spacing,
+              std::vector<double> const& values);
+
+    /// Reads a map from a binary file (see the class description for the format).
+    /// @throw std::runtime_error if the file can't be read or is not a valid map
+    static GridMap3D ReadFrom(std::string const& fileName);
+
+    /// Writes the map into a binary file (see the class description for the format).
+    /// @throw std::runtime_error if the file can't be written
+    void WriteTo(std::string const& fileName) const;
+
+    /// Returns a map with the same grid and `f` applied to each node value.
+    GridMap3D Transformed(std::function<double(double)> const& f) const;
+
+    /// @{
+    /// @name Grid
+
+    Size_t const&
+    NNodes() const noexcept
+    {
+      return fNNodes;
+    }
+    Vector_t const&
+    Origin() const noexcept
+    {
+      return fOrigin;
+    }
+    Vector_t const&
+    Spacing() const noexcept
+    {
+      return fSpacing;
+    }
+
+    /// Returns the value at the node with the specified indices.
+    double
+    NodeValue(unsigned int const i, unsigned int const j, unsigned int const k) const noexcept
+    {
+      return fValues[storageIndex(i, j, k)];
+    }
+
+    /// @}
+
+    /// Returns the value interpolated at the specified point.
+    double operator()(double x, double y, double z) const noexcept;
+
+    /**
+     * @brief Interpolates the values at many points.
+     * @param x pointer to the first of `n` x coordinates
+     * @param y pointer to the first of `n` y coordinates
+     * @param z pointer to the first of `n` z coordinates
+     * @param n number of points
+     * @param values pointer to the first of the `n` interpolated values
+     */
+    void Interpolate(double const* x,
+                     double const* y,
+                     double const* z,
+                     std::size_t n,
+                     double* values) const noexcept;
+
+  private:
+    Size_t fNNodes;           ///< Number of nodes along each axis.
+    Size_t fNBlocks;          ///< Number of storage blocks along each axis.
+    Vector_t fOrigin;         ///< Position of the first node.
+    Vector_t fSpacing;        ///< Distance between nodes.
+    Vector_t fInverseSpacing; ///< Inverse of `fSpacing`.
+
+    /// Node values, in blocks.
+    std::vector<double, util::AlignedAllocator<double>> fValues;
+
+    /// Returns the position of the node (i, j, k) in `fValues`.
+    std::size_t
+    storageIndex(unsigned int const i, unsigned int const j, unsigned int const k) const noexcept
+    {
+      std::size_t const block =
+        (std::size_t(k / BlockSize) * fNBlocks[1] + j / BlockSize) * fNBlocks[0] + i / BlockSize;
+      return block * (BlockSize * BlockSize * BlockSize) +
+             ((k % BlockSize) * BlockSize + j % BlockSize) * BlockSize + i % BlockSize;
+    }
+
+    /// Splits a coordinate into lower node index and fraction, along `axis`.
+    void locate(unsigned int axis, double pos, unsigned int& index, double& fraction) const
+      noexcept;
+
+  }; // class GridMap3D
+
+} // namespace detinfo
+
+#endif // LARDATAALG_DETECTORINFO_GRIDMAP3D_H
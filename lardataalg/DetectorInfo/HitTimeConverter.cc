@@ -0,0 +1,48 @@
+#include "lardataalg/DetectorInfo/HitTimeConverter.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+
+//------------------------------------------------------------------------------
+detinfo::HitTimeConverter::HitTimeConverter(DetectorClocksData const& clockData,
+                                            DetectorPropertiesData const& detProp)
+{
+  double const tickPeriod = clockData.TPCClock().TickPeriod(); // us
+  fTickToElecTime = {tickPeriod, clockData.TPCTick2Time(0.0)};
+  fTickToTrigTime = {tickPeriod, clockData.TPCTick2TrigTime(0.0)};
+  fElecTimeToTick = fTickToElecTime.inverse();
+  fTrigTimeToTick = fTickToTrigTime.inverse();
+  fTrigTimeToElecTime = fTrigTimeToTick.then(fTickToElecTime);
+  fElecTimeToTrigTime = fElecTimeToTick.then(fTickToTrigTime);
+
+  XTicksTable const& table = detProp.XTicks();
+  fFirstTPC.push_back(0U);
+  fFirstPlane.push_back(0U);
+  for (unsigned int c = 0; c < table.NCryostats(); ++c) {
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t) {
+      double const coefficient = table.Coefficient(t, c); // cm/tick
+      for (unsigned int p = 0; p < table.NPlanes(t, c); ++p) {
+        PlaneTransforms_t planeTransforms;
+        planeTransforms.tickToX = {coefficient, -table.Offset(p, t, c) * coefficient};
+        planeTransforms.xToTick = planeTransforms.tickToX.inverse();
+        planeTransforms.elecTimeToX = fElecTimeToTick.then(planeTransforms.tickToX);
+        planeTransforms.xToElecTime = planeTransforms.xToTick.then(fTickToElecTime);
+        planeTransforms.trigTimeToX = fTrigTimeToTick.then(planeTransforms.tickToX);
+        planeTransforms.xToTrigTime = planeTransforms.xToTick.then(fTickToTrigTime);
+        fPlanes.push_back(planeTransforms);
+      }
+      fFirstPlane.push_back(fPlanes.size());
+    }
+    fFirstTPC.push_back(fFirstPlane.size() - 1U);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool
+detinfo::HitTimeConverter::HasPlane(geo::PlaneID const& planeid) const noexcept
+{
+  if (planeid.Cryostat + 1U >= fFirstTPC.size()) return false;
+  std::size_t const tpc = fFirstTPC[planeid.Cryostat] + planeid.TPC;
+  if (tpc >= fFirstTPC[planeid.Cryostat + 1U]) return false;
+  return fFirstPlane[tpc] + planeid.Plane < fFirstPlane[tpc + 1U];
+}
@@ -0,0 +1,244 @@
+/**
+ * @file   lardataalg/DetectorInfo/HitTimeConverter.h
+ * @brief  Conversions between the times of a hit and its drift coordinate.
+ * @see    lardataalg/DetectorInfo/HitTimeConverter.cc
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_HITTIMECONVERTER_H
+#define LARDATAALG_DETECTORINFO_HITTIMECONVERTER_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/AffineTransform.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace detinfo {
+
+  class DetectorClocksData;
+  class DetectorPropertiesData;
+
+  /**
+   * @brief Converts hit times and drift coordinates into one another.
+   *
+   * Reconstruction often chains `DetectorClocksData::TPCTick2TrigTime()`,
+   * `DetectorClocksData::TPCTick2Time()` and
+   * `DetectorPropertiesData::ConvertTicksToX()` for each hit.
+   * All these are affine transformations, and this object combines them once,
+   * at construction, into a single multiply-add for each plane and each pair
+   * of the quantities:
+   *
+   * * @ref DetectorClocksElectronicsTime "electronics time" [&micro;s];
+   * * @ref DetectorClocksTriggerTime "trigger time" [&micro;s];
+   * * TPC ticks, as in `DetectorPropertiesData::ConvertTicksToX()`;
+   * * drift coordinate [cm].
+   *
+   * The results are the same as the chained calls up to rounding.
+   * The converter is a copy of the relevant parameters, and it does not need
+   * the original data to stay around; it must be rebuilt when they change.
+   *
+   * Example:
+   *
+   *     detinfo::HitTimeConverter const converter{ clockData, detProp };
+   *     double const x = converter.TrigTimeToX(hitTime, hit.WireID());
+   *
+   * Batch versions of the conversions take an input array and fill an output
+   * array of the same size, which may also be the input array itself.
+   * As in `XTicksTable`, the plane is not checked to exist except in debug
+   * builds.
+   */
+  class HitTimeConverter {
+  public:
+    /// Affine transformation `scale * value + shift`.
+    using Transform_t = AffineTransform;
+
+    /// Builds the conversions from the specified clocks and properties.
+    HitTimeConverter(DetectorClocksData const& clockData, DetectorPropertiesData const& detProp);
+
+    /// Returns whether the specified plane is known to this converter.
+    bool HasPlane(geo::PlaneID const& planeid) const noexcept;
+
+    /// @{
+    /// @name Plane-independent time conversions
+
+    /// Converts TPC ticks into electronics time [&micro;s].
+    double
+    TickToElecTime(double const tick) const noexcept
+    {
+      return fTickToElecTime(tick);
+    }
+
+    /// Converts electronics time [&micro;s] into TPC ticks.
+    double
+    ElecTimeToTick(double const time) const noexcept
+    {
+      return fElecTimeToTick(time);
+    }
+
+    /// Converts TPC ticks into trigger time [&micro;s].
+    double
+    TickToTrigTime(double const tick) const noexcept
+    {
+      return fTickToTrigTime(tick);
+    }
+
+    /// Converts trigger time [&micro;s] into TPC ticks.
+    double
+    TrigTimeToTick(double const time) const noexcept
+    {
+      return fTrigTimeToTick(time);
+    }
+
+    /// Converts trigger time [&micro;s] into electronics time [&micro;s].
+    double
+    TrigTimeToElecTime(double const time) const noexcept
+    {
+      return fTrigTimeToElecTime(time);
+    }
+
+    /// Converts electronics time [&micro;s] into trigger time [&micro;s].
+    double
+    ElecTimeToTrigTime(double const time) const noexcept
+    {
+      return fElecTimeToTrigTime(time);
+    }
+
+    /// @}
+
+    /// @{
+    /// @name Conversions on a plane
+
+    /// Converts TPC ticks on the specified plane into drift coordinate [cm].
+    double
+    TickToX(double const tick, geo::PlaneID const& planeid) const noexcept
+    {
+      return plane(planeid).tickToX(tick);
+    }
+
+    /// Converts a drift coordinate [cm] into TPC ticks on the specified plane.
+    double
+    XToTick(double const x, geo::PlaneID const& planeid) const noexcept
+    {
+      return plane(planeid).xToTick(x);
+    }
+
+    /// Converts electronics time [&micro;s] on the plane into drift coordinate [cm].
+    double
+    ElecTimeToX(double const time, geo::PlaneID const& planeid) const noexcept
+    {
+      return plane(planeid).elecTimeToX(time);
+    }
+
+    /// Converts a drift coordinate [cm] into electronics time [&micro;s] on the plane.
+    double
+    XToElecTime(double const x, geo::PlaneID const& planeid) const noexcept
+    {
+      return plane(planeid).xToElecTime(x);
+    }
+
+    /// Converts trigger time [&micro;s] on the plane into drift coordinate [cm].
+    double
+    TrigTimeToX(double const time, geo::PlaneID const& planeid) const noexcept
+    {
+      return plane(planeid).trigTimeToX(time);
+    }
+
+    /// Converts a drift coordinate [cm] into trigger time [&micro;s] on the plane.
+    double
+    XToTrigTime(double const x, geo::PlaneID const& planeid) const noexcept
+    {
+      return plane(planeid).xToTrigTime(x);
+    }
+
+    /// @}
+
+    /// @{
+    /**
+     * @name Batch conversions on a plane
+     * @param in pointer to the first of `n` values to convert
+     * @param n number of values to convert
+     * @param out pointer to the first of the `n` converted values
+     * @param planeid plane all the values are converted for
+     */
+
+    void
+    TickToX(double const* in, std::size_t n, double* out, geo::PlaneID const& planeid) const
+      noexcept
+    {
+      plane(planeid).tickToX.apply(in, n, out);
+    }
+
+    void
+    XToTick(double const* in, std::size_t n, double* out, geo::PlaneID const& planeid) const
+      noexcept
+    {
+      plane(planeid).xToTick.apply(in, n, out);
+    }
+
+    void
+    ElecTimeToX(double const* in, std::size_t n, double* out, geo::PlaneID const& planeid) const
+      noexcept
+    {
+      plane(planeid).elecTimeToX.apply(in, n, out);
+    }
+
+    void
+    XToElecTime(double const* in, std::size_t n, double* out, geo::PlaneID const& planeid) const
+      noexcept
+    {
+      plane(planeid).xToElecTime.apply(in, n, out);
+    }
+
+    void
+    TrigTimeToX(double const* in, std::size_t n, double* out, geo::PlaneID const& planeid) const
+      noexcept
+    {
+      plane(planeid).trigTimeToX.apply(in, n, out);
+    }
+
+    void
+    XToTrigTime(double const* in, std::size_t n, double* out, geo::PlaneID const& planeid) const
+      noexcept
+    {
+      plane(planeid).xToTrigTime.apply(in, n, out);
+    }
+
+    /// @}
+
+  private:
+    /// All the transformations involving the drift coordinate on a plane.
+    struct PlaneTransforms_t {
+      Transform_t tickToX;
+      Transform_t xToTick;
+      Transform_t elecTimeToX;
+      Transform_t xToElecTime;
+      Transform_t trigTimeToX;
+      Transform_t xToTrigTime;
+    };
+
+    Transform_t fTickToElecTime;
+    Transform_t fElecTimeToTick;
+    Transform_t fTickToTrigTime;
+    Transform_t fTrigTimeToTick;
+    Transform_t fTrigTimeToElecTime;
+    Transform_t fElecTimeToTrigTime;
+
+    std::vector<std::size_t> fFirstTPC;     ///< First TPC of each cryostat, plus end.
+    std::vector<std::size_t> fFirstPlane;   ///< First plane of each TPC, plus end.
+    std::vector<PlaneTransforms_t> fPlanes; ///< Transformations of all the planes.
+
+    PlaneTransforms_t const&
+    plane(geo::PlaneID const& planeid) const noexcept
+    {
+      assert(HasPlane(planeid));
+      return fPlanes[fFirstPlane[fFirstTPC[planeid.Cryostat] + planeid.TPC] + planeid.Plane];
+    }
+
+  }; // class HitTimeConverter
+
+} // namespace detinfo
+
+#endif // LARDATAALG_DETECTORINFO_HITTIMECONVERTER_H
@@ -6,6 +6,7 @@
 
 // LArSoft includes
 #include "lardataalg/DetectorInfo/LArPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
 #include "larcorealg/CoreUtils/ProviderUtil.h" // lar::IgnorableProviderConfigKeys()
 
 // ROOT includes
@@ -243,6 +244,7 @@ bool detinfo::LArPropertiesStandard::Update(uint64_t ts)
 //---------------------------------------------------------------------------------
 std::map<double,double> detinfo::LArPropertiesStandard::FastScintSpectrum() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::FastScintSpectrum");
   if(fFastScintSpectrum.size()!=fFastScintEnergies.size()){
     throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
       << "The vectors specifying the fast scintillation spectrum are "
@@ -260,6 +262,7 @@ std::map<double,double> detinfo::LArPropertiesStandard::FastScintSpectrum() cons
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::SlowScintSpectrum() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::SlowScintSpectrum");
   if(fSlowScintSpectrum.size()!=fSlowScintEnergies.size()){
       throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
   << "The vectors specifying the slow scintillation spectrum are "
@@ -277,6 +280,7 @@ std::map<double, double> detinfo::LArPropertiesStandard::SlowScintSpectrum() con
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::RIndexSpectrum() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::RIndexSpectrum");
   if(fRIndexSpectrum.size()!=fRIndexEnergies.size()){
       throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
   << "The vectors specifying the RIndex spectrum are "
@@ -295,6 +299,7 @@ std::map<double, double> detinfo::LArPropertiesStandard::RIndexSpectrum() const
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::AbsLengthSpectrum() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::AbsLengthSpectrum");
   if(fAbsLengthSpectrum.size()!=fAbsLengthEnergies.size()){
     throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
       << "The vectors specifying the Abs Length spectrum are "
@@ -312,6 +317,7 @@ std::map<double, double> detinfo::LArPropertiesStandard::AbsLengthSpectrum() con
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::RayleighSpectrum() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::RayleighSpectrum");
   if(fRayleighSpectrum.size()!=fRayleighEnergies.size()){
     throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
       << "The vectors specifying the rayleigh spectrum are "
@@ -329,6 +335,7 @@ std::map<double, double> detinfo::LArPropertiesStandard::RayleighSpectrum() cons
 //---------------------------------------------------------------------------------
 std::map<std::string, std::map<double,double> > detinfo::LArPropertiesStandard::SurfaceReflectances() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::SurfaceReflectances");
   std::map<std::string, std::map<double, double> > ToReturn;
 
   if(fReflectiveSurfaceNames.size()!=fReflectiveSurfaceReflectances.size()){
@@ -353,6 +360,7 @@ std::map<std::string, std::map<double,double> > detinfo::LArPropertiesStandard::
 //---------------------------------------------------------------------------------
 std::map<std::string, std::map<double,double> > detinfo::LArPropertiesStandard::SurfaceReflectanceDiffuseFractions() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::SurfaceReflectanceDiffuseFractions");
   std::map<std::string, std::map<double, double> > ToReturn;
 
   if(fReflectiveSurfaceNames.size()!=fReflectiveSurfaceDiffuseFractions.size()){
@@ -375,6 +383,7 @@ std::map<std::string, std::map<double,double> > detinfo::LArPropertiesStandard::
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::TpbAbs() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::TpbAbs");
   if(fTpbAbsorptionEnergies.size()!=fTpbAbsorptionSpectrum.size()){
     throw cet::exception("Incorrect vector sizes in LArProperties")
       << "The vectors specifying the TpbAbsorption spectrum are "
@@ -391,6 +400,7 @@ std::map<double, double> detinfo::LArPropertiesStandard::TpbAbs() const
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::TpbEm() const
 {
+  DETINFO_INSTRUMENTED_CALL("LArPropertiesStandard::TpbEm");
   if(fTpbEmmisionEnergies.size()!=fTpbEmmisionSpectrum.size()){
     throw cet::exception("Incorrect vector sizes in LArProperties")
       << "The vectors specifying the TpbEmmision spectrum are "
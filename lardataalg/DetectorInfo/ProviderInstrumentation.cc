@@ -0,0 +1,124 @@
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
+
+// C/C++ standard libraries
+#include <chrono>
+#include <memory> // std::unique_ptr
+#include <mutex>
+#include <stdexcept> // std::length_error
+#include <utility>   // std::move()
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h> // __rdtsc()
+#endif
+
+namespace {
+
+  /// Methods and counters of all the threads; threads never unregister.
+  struct Registry_t {
+    std::mutex mutex;
+    std::vector<std::string> names;
+    std::vector<std::unique_ptr<detinfo::instrumentation::details::ThreadCounters_t>> threads;
+  };
+
+  Registry_t&
+  registry()
+  {
+    static Registry_t instance;
+    return instance;
+  }
+
+  /// Returns the current time stamp [ticks].
+  std::uint64_t
+  readTicks() noexcept
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+detinfo::instrumentation::Method::Method(char const* name)
+{
+  Registry_t& reg = registry();
+  std::lock_guard<std::mutex> const lock{reg.mutex};
+  if (reg.names.size() >= MaxMethods) {
+    throw std::length_error("detinfo::instrumentation: more than " + std::to_string(MaxMethods) +
+                            " instrumented methods");
+  }
+  fIndex = reg.names.size();
+  reg.names.emplace_back(name);
+}
+
+//------------------------------------------------------------------------------
+detinfo::instrumentation::details::ThreadCounters_t&
+detinfo::instrumentation::details::threadCounters()
+{
+  thread_local ThreadCounters_t* counters = [] {
+    Registry_t& reg = registry();
+    std::lock_guard<std::mutex> const lock{reg.mutex};
+    reg.threads.push_back(std::make_unique<ThreadCounters_t>());
+    return reg.threads.back().get();
+  }();
+  return *counters;
+}
+
+//------------------------------------------------------------------------------
+detinfo::instrumentation::ScopedCall::ScopedCall(Method const& method)
+  : fCounter{details::threadCounters()[method.index()]}
+{
+  std::uint64_t const calls = fCounter.calls.load(std::memory_order_relaxed);
+  fCounter.calls.store(calls + 1U, std::memory_order_relaxed);
+  if constexpr (Level > 1U) {
+    if (calls % TimingSamplingPeriod == 0U) fStart = readTicks();
+  }
+}
+
+detinfo::instrumentation::ScopedCall::~ScopedCall()
+{
+  if constexpr (Level > 1U) {
+    if (fStart == 0U) return;
+    details::add(fCounter.timedTicks, readTicks() - fStart);
+    details::add(fCounter.timedCalls, 1U);
+  }
+}
+
+//------------------------------------------------------------------------------
+std::vector<detinfo::instrumentation::MethodStats_t>
+detinfo::instrumentation::collect()
+{
+  Registry_t& reg = registry();
+  std::lock_guard<std::mutex> const lock{reg.mutex};
+
+  std::vector<MethodStats_t> stats;
+  for (std::size_t i = 0; i < reg.names.size(); ++i) {
+    MethodStats_t methodStats{reg.names[i], 0U, 0U, 0U};
+    for (auto const& counters : reg.threads) {
+      details::Counter_t const& counter = (*counters)[i];
+      methodStats.calls += counter.calls.load(std::memory_order_relaxed);
+      methodStats.timedCalls += counter.timedCalls.load(std::memory_order_relaxed);
+      methodStats.timedTicks += counter.timedTicks.load(std::memory_order_relaxed);
+    }
+    stats.push_back(std::move(methodStats));
+  }
+  return stats;
+}
+
+//------------------------------------------------------------------------------
+void
+detinfo::instrumentation::reset()
+{
+  Registry_t& reg = registry();
+  std::lock_guard<std::mutex> const lock{reg.mutex};
+  for (auto const& counters : reg.threads) {
+    for (details::Counter_t& counter : *counters) {
+      counter.calls.store(0U, std::memory_order_relaxed);
+      counter.timedCalls.store(0U, std::memory_order_relaxed);
+      counter.timedTicks.store(0U, std::memory_order_relaxed);
+    }
+  }
+}
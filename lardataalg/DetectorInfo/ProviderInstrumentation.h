@@ -0,0 +1,169 @@
+/**
+ * @file   lardataalg/DetectorInfo/ProviderInstrumentation.h
+ * @brief  Optional call counters and timers for the detector information providers.
+ * @see    lardataalg/DetectorInfo/ProviderInstrumentation.cc
+ *
+ * The instrumentation is enabled at compile time by defining the preprocessor
+ * macro `LARDATAALG_DETECTORINFO_INSTRUMENTATION` when building the library:
+ *
+ * * `0` (default): disabled; instrumented methods are compiled exactly as if
+ *   the instrumentation did not exist;
+ * * `1`: each instrumented method counts its calls;
+ * * `2`: in addition, one call every `TimingSamplingPeriod` is timed with the
+ *   CPU time stamp counter (on other architectures, with
+ *   `std::chrono::steady_clock` in nanoseconds).
+ *
+ * For example, `cmake -DCMAKE_CXX_FLAGS=-DLARDATAALG_DETECTORINFO_INSTRUMENTATION=2 ...`.
+ *
+ * Only methods compiled in the library are instrumented, and not the ones
+ * defined in headers, so that the setting of the library is not required to
+ * match the one of the code using it.
+ *
+ * The counters are kept per thread, so that counting needs no
+ * synchronization; `report()` sums the counts of all the threads, including
+ * the ones already ended.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_PROVIDERINSTRUMENTATION_H
+#define LARDATAALG_DETECTORINFO_PROVIDERINSTRUMENTATION_H
+
+// C/C++ standard libraries
+#include <array>
+#include <atomic>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <string>
+#include <vector>
+
+#ifndef LARDATAALG_DETECTORINFO_INSTRUMENTATION
+#define LARDATAALG_DETECTORINFO_INSTRUMENTATION 0
+#endif
+
+/**
+ * @brief Instruments the enclosing function as the method called `name`.
+ *
+ * To be used once, at the beginning of the function body.
+ * It expands to nothing if the instrumentation is disabled.
+ */
+#if LARDATAALG_DETECTORINFO_INSTRUMENTATION > 0
+#define DETINFO_INSTRUMENTED_CALL(name)                                               \
+  static ::detinfo::instrumentation::Method const detinfo_instrumented_method_{name}; \
+  ::detinfo::instrumentation::ScopedCall const detinfo_instrumented_call_             \
+  {                                                                                   \
+    detinfo_instrumented_method_                                                      \
+  }
+#else
+#define DETINFO_INSTRUMENTED_CALL(name) static_cast<void>(0)
+#endif
+
+namespace detinfo::instrumentation {
+
+  /// Instrumentation level of this compilation unit (see the file description).
+  constexpr unsigned int Level = LARDATAALG_DETECTORINFO_INSTRUMENTATION;
+
+  /// Maximum number of methods which can be instrumented.
+  constexpr std::size_t MaxMethods = 128U;
+
+  /// When timing, one call every this many is timed.
+  constexpr std::uint64_t TimingSamplingPeriod = 64U;
+
+  /// Statistics of an instrumented method, summed over all threads.
+  struct MethodStats_t {
+    std::string name;         ///< Name of the method.
+    std::uint64_t calls;      ///< Number of calls.
+    std::uint64_t timedCalls; ///< Number of timed calls.
+    std::uint64_t timedTicks; ///< Total duration of the timed calls [ticks].
+
+    /// Average duration of a timed call [ticks].
+    double
+    averageTicks() const
+    {
+      return (timedCalls > 0U) ? static_cast<double>(timedTicks) / timedCalls : 0.0;
+    }
+  }; // MethodStats_t
+
+  /// Identifier of an instrumented method; create one for each method.
+  class Method {
+  public:
+    /// Registers the method `name`; throws `std::length_error` if too many.
+    explicit Method(char const* name);
+
+    std::size_t
+    index() const noexcept
+    {
+      return fIndex;
+    }
+
+  private:
+    std::size_t fIndex;
+  }; // class Method
+
+  namespace details {
+
+    /// Counters of a method in one thread; only that thread writes them.
+    struct Counter_t {
+      std::atomic<std::uint64_t> calls{0U};
+      std::atomic<std::uint64_t> timedCalls{0U};
+      std::atomic<std::uint64_t> timedTicks{0U};
+    };
+
+    using ThreadCounters_t = std::array<Counter_t, MaxMethods>;
+
+    /// Returns the counters of the current thread.
+    ThreadCounters_t& threadCounters();
+
+    /// Adds `n` to a counter only the current thread writes (no atomic increment).
+    inline void
+    add(std::atomic<std::uint64_t>& counter, std::uint64_t const n) noexcept
+    {
+      counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+  } // namespace details
+
+  /**
+   * @brief Counts (and possibly times) the call of a method during its lifetime.
+   *
+   * Constructor and destructor are compiled in the library, so that their
+   * behaviour follows the instrumentation level of the library whatever the
+   * level of the code creating the object.
+   */
+  class ScopedCall {
+  public:
+    explicit ScopedCall(Method const& method);
+
+    ~ScopedCall();
+
+    ScopedCall(ScopedCall const&) = delete;
+    ScopedCall& operator=(ScopedCall const&) = delete;
+
+  private:
+    details::Counter_t& fCounter;
+    std::uint64_t fStart = 0U; ///< Start of a timed call, `0` if not timed.
+  }; // class ScopedCall
+
+  /// Returns the statistics of all the methods called so far.
+  std::vector<MethodStats_t> collect();
+
+  /// Resets all the counters of all the threads (calls in progress may be missed).
+  void reset();
+
+  /// Prints the statistics of all the methods called so far into `out`.
+  template <typename Stream>
+  void
+  report(Stream&& out)
+  {
+    out << "Detector information provider calls (instrumentation level " << Level << "):";
+    for (MethodStats_t const& stats : collect()) {
+      if (stats.calls == 0U) continue;
+      out << "\n  " << stats.name << ": " << stats.calls << " calls";
+      if (stats.timedCalls > 0U) {
+        out << ", " << stats.averageTicks() << " ticks/call (" << stats.timedCalls
+            << " calls timed)";
+      }
+    }
+  }
+
+} // namespace detinfo::instrumentation
+
+#endif // LARDATAALG_DETECTORINFO_PROVIDERINSTRUMENTATION_H
@@ -0,0 +1,114 @@
+/**
+ * @file   lardataalg/DetectorInfo/RecombinationModels.h
+ * @brief  Recombination models relating ionization charge and energy loss.
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_RECOMBINATIONMODELS_H
+#define LARDATAALG_DETECTORINFO_RECOMBINATIONMODELS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::exp(), std::log()
+
+namespace detinfo {
+
+  /// Ionization energy per electron, 23.6 eV [MeV].
+  constexpr double RecombinationWion = 1000. / util::kGeVToElectrons;
+
+  /**
+   * @brief Birks recombination model.
+   *
+   * Parameterization from S. Amoruso et al., NIM A 523 (2004) 275:
+   * @f[ \frac{dE}{dx} = \frac{dQ/dx}{A/W - k/(\rho E) \, dQ/dx} @f]
+   * with the constants `util::kRecombA` and `util::kRecombk`.
+   * The model is set for a given argon density and electric field, and
+   * converts in both directions:
+   * * `EnergyLoss()`: collected charge to deposited energy (reconstruction);
+   * * `Charge()`: deposited energy to collected charge (simulation).
+   *
+   * Charge is in electrons/cm, energy loss in MeV/cm.
+   */
+  class BirksModel {
+  public:
+    /**
+     * @brief Sets the model for the specified conditions.
+     * @param density argon density [g/cm^3]
+     * @param efield electric field [kV/cm]
+     */
+    BirksModel(double const density, double const efield)
+      : fKOverE{util::kRecombk / density / efield}
+    {}
+
+    /// Returns the energy loss [MeV/cm] corresponding to `dQdx` [electrons/cm].
+    double
+    EnergyLoss(double const dQdx) const
+    {
+      return dQdx / (AoverWion - fKOverE * dQdx);
+    }
+
+    /// Returns the charge [electrons/cm] corresponding to `dEdx` [MeV/cm].
+    double
+    Charge(double const dEdx) const
+    {
+      return AoverWion * dEdx / (1. + fKOverE * dEdx);
+    }
+
+  private:
+    static constexpr double AoverWion = util::kRecombA / RecombinationWion; ///< [electrons/MeV]
+
+    double fKOverE; ///< k/(rho E) [cm/MeV]
+  }; // class BirksModel
+
+  /**
+   * @brief Modified box recombination model.
+   *
+   * Parameterization from the ArgoNeuT collaboration, JINST 8 (2013) P08005:
+   * @f[ \frac{dE}{dx} = \frac{e^{\beta W dQ/dx} - \alpha}{\beta} @f]
+   * with @f$ \alpha @f$ `util::kModBoxA` and
+   * @f$ \beta = B / (\rho E) @f$ from `util::kModBoxB`.
+   * The model is set for a given argon density and electric field, and
+   * converts in both directions:
+   * * `EnergyLoss()`: collected charge to deposited energy (reconstruction);
+   * * `Charge()`: deposited energy to collected charge (simulation).
+   *
+   * Charge is in electrons/cm, energy loss in MeV/cm.
+   */
+  class ModBoxModel {
+  public:
+    /**
+     * @brief Sets the model for the specified conditions.
+     * @param density argon density [g/cm^3]
+     * @param efield electric field [kV/cm]
+     */
+    ModBoxModel(double const density, double const efield)
+      : fBeta{util::kModBoxB / (density * efield)}, fBetaWion{fBeta * RecombinationWion}
+    {}
+
+    /// Returns the energy loss [MeV/cm] corresponding to `dQdx` [electrons/cm].
+    double
+    EnergyLoss(double const dQdx) const
+    {
+      return (std::exp(fBetaWion * dQdx) - Alpha) / fBeta;
+    }
+
+    /// Returns the charge [electrons/cm] corresponding to `dEdx` [MeV/cm].
+    double
+    Charge(double const dEdx) const
+    {
+      return std::log(Alpha + fBeta * dEdx) / fBetaWion;
+    }
+
+  private:
+    static constexpr double Alpha = util::kModBoxA;
+
+    double fBeta;     ///< B/(rho E) [cm/MeV]
+    double fBetaWion; ///< B W/(rho E) [cm/electrons]
+  }; // class ModBoxModel
+
+} // namespace detinfo
+
+#endif // LARDATAALG_DETECTORINFO_RECOMBINATIONMODELS_H
@@ -0,0 +1,144 @@
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <stdexcept> // std::out_of_range
+#include <string>
+
+detinfo::XTicksTable::XTicksTable(std::vector<std::vector<unsigned int>> const& nPlanes)
+{
+  unsigned int maxPlanes = 0U;
+  fFirstTPC.reserve(nPlanes.size() + 1U);
+  fFirstTPC.push_back(0U);
+  for (auto const& cryoPlanes : nPlanes) {
+    for (unsigned int const n : cryoPlanes) {
+      fNPlanes.push_back(n);
+      maxPlanes = std::max(maxPlanes, n);
+    }
+    fFirstTPC.push_back(fNPlanes.size());
+  }
+
+  // round the row up to a whole number of cache lines
+  fRowSize = ((NHeaderValues + maxPlanes + LineSize - 1U) / LineSize) * LineSize;
+  fTable.assign(fNPlanes.size() * fRowSize, 0.0);
+}
+
+detinfo::XTicksTable::XTicksTable(
+  double const x_ticks_coefficient,
+  std::vector<std::vector<std::vector<double>>> const& x_ticks_offsets,
+  std::vector<std::vector<double>> const& drift_direction)
+  : XTicksTable{[&x_ticks_offsets] {
+    std::vector<std::vector<unsigned int>> nPlanes;
+    nPlanes.reserve(x_ticks_offsets.size());
+    for (auto const& cryoOffsets : x_ticks_offsets) {
+      auto& cryoPlanes = nPlanes.emplace_back();
+      for (auto const& tpcOffsets : cryoOffsets)
+        cryoPlanes.push_back(tpcOffsets.size());
+    }
+    return nPlanes;
+  }()}
+{
+  for (unsigned int c = 0; c < x_ticks_offsets.size(); ++c) {
+    for (unsigned int t = 0; t < x_ticks_offsets[c].size(); ++t) {
+      SetCoefficient(t, c, x_ticks_coefficient * drift_direction.at(c).at(t));
+      for (unsigned int p = 0; p < x_ticks_offsets[c][t].size(); ++p)
+        SetOffset(p, t, c, x_ticks_offsets[c][t][p]);
+    }
+  }
+}
+
+unsigned int
+detinfo::XTicksTable::NTPCs(unsigned int const c) const noexcept
+{
+  return (c < NCryostats()) ? fFirstTPC[c + 1] - fFirstTPC[c] : 0U;
+}
+
+unsigned int
+detinfo::XTicksTable::NPlanes(unsigned int const t, unsigned int const c) const noexcept
+{
+  return (t < NTPCs(c)) ? fNPlanes[fFirstTPC[c] + t] : 0U;
+}
+
+void
+detinfo::XTicksTable::XToTicks(double const* x,
+                               std::size_t const n,
+                               double* ticks,
+                               unsigned int const p,
+                               unsigned int const t,
+                               unsigned int const c) const noexcept
+{
+  assert(HasPlane(p, t, c));
+  double const* row = Row(t, c);
+  double const ticksPerCm = row[0];
+  double const offset = row[NHeaderValues + p];
+  for (std::size_t i = 0; i < n; ++i)
+    ticks[i] = x[i] * ticksPerCm + offset;
+}
+
+void
+detinfo::XTicksTable::TicksToX(double const* ticks,
+                               std::size_t const n,
+                               double* x,
+                               unsigned int const p,
+                               unsigned int const t,
+                               unsigned int const c) const noexcept
+{
+  assert(HasPlane(p, t, c));
+  double const* row = Row(t, c);
+  double const cmPerTick = row[1];
+  double const offset = row[NHeaderValues + p];
+  for (std::size_t i = 0; i < n; ++i)
+    x[i] = (ticks[i] - offset) * cmPerTick;
+}
+
+double
+detinfo::XTicksTable::CoefficientAt(unsigned int const t, unsigned int const c) const
+{
+  return fTable[rowIndexAt(t, c) * fRowSize + 1U];
+}
+
+double
+detinfo::XTicksTable::OffsetAt(unsigned int const p, unsigned int const t, unsigned int const c)
+  const
+{
+  std::size_t const row = rowIndexAt(t, c);
+  if (p >= fNPlanes[row]) {
+    throw std::out_of_range("XTicksTable: plane " + std::to_string(p) + " not in C:" +
+                            std::to_string(c) + " T:" + std::to_string(t));
+  }
+  return fTable[row * fRowSize + NHeaderValues + p];
+}
+
+void
+detinfo::XTicksTable::SetCoefficient(unsigned int const t,
+                                     unsigned int const c,
+                                     double const coefficient)
+{
+  std::size_t const row = rowIndexAt(t, c) * fRowSize;
+  fTable[row] = 1.0 / coefficient;
+  fTable[row + 1U] = coefficient;
+}
+
+void
+detinfo::XTicksTable::SetOffset(unsigned int const p,
+                                unsigned int const t,
+                                unsigned int const c,
+                                double const offset)
+{
+  std::size_t const row = rowIndexAt(t, c);
+  if (p >= fNPlanes[row]) {
+    throw std::out_of_range("XTicksTable: plane " + std::to_string(p) + " not in C:" +
+                            std::to_string(c) + " T:" + std::to_string(t));
+  }
+  fTable[row * fRowSize + NHeaderValues + p] = offset;
+}
+
+std::size_t
+detinfo::XTicksTable::rowIndexAt(unsigned int const t, unsigned int const c) const
+{
+  if (t >= NTPCs(c)) {
+    throw std::out_of_range("XTicksTable: TPC C:" + std::to_string(c) + " T:" +
+                            std::to_string(t) + " not present");
+  }
+  return fFirstTPC[c] + t;
+}
@@ -0,0 +1,244 @@
+/**
+ * @file   lardataalg/DetectorInfo/XTicksTable.h
+ * @brief  Packed table of drift coordinate/TPC tick conversion parameters.
+ * @see    lardataalg/DetectorInfo/XTicksTable.cc
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_XTICKSTABLE_H
+#define LARDATAALG_DETECTORINFO_XTICKSTABLE_H
+
+// LArSoft libraries
+#include "lardataalg/Utilities/AlignedAllocator.h"
+
+// C/C++ standard libraries
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <utility> // std::pair
+#include <vector>
+
+namespace detinfo {
+
+  /**
+   * @brief Conversion parameters between drift coordinate and TPC ticks.
+   *
+   * The table stores, for each TPC, a row with the conversion coefficient
+   * (already including the sign of the drift direction) and the tick offset of
+   * each of its planes:
+   *
+   *     [ ticks/cm | cm/tick | offset(plane 0) | offset(plane 1) | ... ]
+   *
+   * Rows are padded to a multiple of a cache line and the storage is aligned,
+   * so that in the common case (up to 6 planes per TPC) all the parameters of
+   * a TPC are in a single cache line, and the conversion of a coordinate is a
+   * single multiply-add.
+   *
+   * Two sets of accessors are available:
+   * * unchecked ones (`XToTicks()`, `TicksToX()`, `Offset()`...), where the
+   *   validity of the requested plane is only verified by assertions, i.e. in
+   *   debug builds;
+   * * checked ones (`OffsetAt()`, `CoefficientAt()`), throwing
+   *   `std::out_of_range` on an invalid plane.
+   *
+   * Batch versions of the conversions take an input array and fill an output
+   * array of the same size, which may also be the input array itself.
+   * The conversions on a single plane are simple loops the compiler can
+   * vectorize.
+   */
+  class XTicksTable {
+  public:
+    /// Number of `double` elements in a cache line.
+    static constexpr std::size_t LineSize = util::CacheLineSize / sizeof(double);
+
+    /// Number of parameters in a row before the plane offsets.
+    static constexpr std::size_t NHeaderValues = 2U;
+
+    /// Creates an empty table.
+    XTicksTable() = default;
+
+    /**
+     * @brief Creates a table for the specified layout, with all values null.
+     * @param nPlanes number of planes, per cryostat and per TPC
+     *
+     * The values should then be filled with `SetCoefficient()` and
+     * `SetOffset()`.
+     */
+    explicit XTicksTable(std::vector<std::vector<unsigned int>> const& nPlanes);
+
+    /**
+     * @brief Creates a table from values in nested containers.
+     * @param x_ticks_coefficient conversion coefficient [cm/tick]
+     * @param x_ticks_offsets tick offsets, per cryostat, TPC and plane
+     * @param drift_direction drift direction (+1/-1), per cryostat and TPC
+     */
+    XTicksTable(double x_ticks_coefficient,
+                std::vector<std::vector<std::vector<double>>> const& x_ticks_offsets,
+                std::vector<std::vector<double>> const& drift_direction);
+
+    /// @{
+    /// @name Layout
+
+    /// Returns the number of cryostats in the table.
+    unsigned int
+    NCryostats() const noexcept
+    {
+      return fFirstTPC.empty() ? 0U : fFirstTPC.size() - 1U;
+    }
+
+    /// Returns the number of TPCs in cryostat `c` (0 if not present).
+    unsigned int NTPCs(unsigned int c) const noexcept;
+
+    /// Returns the number of planes in TPC `t` of cryostat `c` (0 if not present).
+    unsigned int NPlanes(unsigned int t, unsigned int c) const noexcept;
+
+    /// Returns whether the specified plane is present in the table.
+    bool
+    HasPlane(unsigned int p, unsigned int t, unsigned int c) const noexcept
+    {
+      return p < NPlanes(t, c);
+    }
+
+    /// Returns the number of `double` values in each row (padded).
+    std::size_t
+    RowSize() const noexcept
+    {
+      return fRowSize;
+    }
+
+    /// @}
+
+    /// @{
+    /// @name Unchecked access
+
+    /// Returns the row of parameters of TPC `t` in cryostat `c`.
+    double const*
+    Row(unsigned int const t, unsigned int const c) const noexcept
+    {
+      assert(t < NTPCs(c));
+      return fTable.data() + (fFirstTPC[c] + t) * fRowSize;
+    }
+
+    /// Returns the conversion coefficient, including the drift direction [cm/tick].
+    double
+    Coefficient(unsigned int const t, unsigned int const c) const noexcept
+    {
+      return Row(t, c)[1];
+    }
+
+    /// Returns the tick offset of plane `p` in TPC `t` of cryostat `c`.
+    double
+    Offset(unsigned int const p, unsigned int const t, unsigned int const c) const noexcept
+    {
+      assert(HasPlane(p, t, c));
+      return Row(t, c)[NHeaderValues + p];
+    }
+
+    /// Converts drift coordinate `x` [cm] into ticks on the specified plane.
+    double
+    XToTicks(double const x, unsigned int const p, unsigned int const t, unsigned int const c) const
+      noexcept
+    {
+      assert(HasPlane(p, t, c));
+      double const* row = Row(t, c);
+      return x * row[0] + row[NHeaderValues + p];
+    }
+
+    /// Converts `ticks` on the specified plane into drift coordinate [cm].
+    double
+    TicksToX(double const ticks, unsigned int const p, unsigned int const t, unsigned int const c)
+      const noexcept
+    {
+      assert(HasPlane(p, t, c));
+      double const* row = Row(t, c);
+      return (ticks - row[NHeaderValues + p]) * row[1];
+    }
+
+    /**
+     * @brief Converts drift coordinates [cm] into ticks on the specified plane.
+     * @param x pointer to the first of the coordinates to convert
+     * @param n number of coordinates to convert
+     * @param ticks pointer to the first of the `n` converted values
+     */
+    void XToTicks(double const* x,
+                  std::size_t n,
+                  double* ticks,
+                  unsigned int p,
+                  unsigned int t,
+                  unsigned int c) const noexcept;
+
+    /**
+     * @brief Converts ticks on the specified plane into drift coordinates [cm].
+     * @param ticks pointer to the first of the ticks to convert
+     * @param n number of ticks to convert
+     * @param x pointer to the first of the `n` converted values
+     */
+    void TicksToX(double const* ticks,
+                  std::size_t n,
+                  double* x,
+                  unsigned int p,
+                  unsigned int t,
+                  unsigned int c) const noexcept;
+
+    /**
+     * @brief Converts ticks on their respective planes into drift coordinates.
+     * @tparam PlaneID type of plane identifier (like `geo::PlaneID`)
+     * @param hits pointer to the first of the (tick, plane) pairs to convert
+     * @param n number of pairs to convert
+     * @param x pointer to the first of the `n` converted values [cm]
+     */
+    template <typename PlaneID>
+    void TicksToX(std::pair<double, PlaneID> const* hits, std::size_t n, double* x) const noexcept;
+
+    /// @}
+
+    /// @{
+    /// @name Checked access
+    /// @throw std::out_of_range if the requested TPC or plane is not present
+
+    /// Returns the conversion coefficient, including the drift direction [cm/tick].
+    double CoefficientAt(unsigned int t, unsigned int c) const;
+
+    /// Returns the tick offset of plane `p` in TPC `t` of cryostat `c`.
+    double OffsetAt(unsigned int p, unsigned int t, unsigned int c) const;
+
+    /// @}
+
+    /// @{
+    /// @name Setters
+
+    /// Sets the conversion coefficient of a TPC [cm/tick], drift sign included.
+    void SetCoefficient(unsigned int t, unsigned int c, double coefficient);
+
+    /// Sets the tick offset of plane `p` in TPC `t` of cryostat `c`.
+    void SetOffset(unsigned int p, unsigned int t, unsigned int c, double offset);
+
+    /// @}
+
+  private:
+    using Storage_t = std::vector<double, util::AlignedAllocator<double>>;
+
+    std::size_t fRowSize = 0U;          ///< Number of values per row (padded).
+    std::vector<std::size_t> fFirstTPC; ///< Row of the first TPC of each cryostat, plus end.
+    std::vector<unsigned int> fNPlanes; ///< Number of planes in each TPC (by row).
+    Storage_t fTable;                   ///< All the parameters, row after row.
+
+    /// Returns the index of the row of the specified TPC, throws if not present.
+    std::size_t rowIndexAt(unsigned int t, unsigned int c) const;
+
+  }; // class XTicksTable
+
+} // namespace detinfo
+
+//------------------------------------------------------------------------------
+template <typename PlaneID>
+void
+detinfo::XTicksTable::TicksToX(std::pair<double, PlaneID> const* hits,
+                               std::size_t const n,
+                               double* x) const noexcept
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    auto const& [ticks, planeid] = hits[i];
+    x[i] = TicksToX(ticks, planeid.Plane, planeid.TPC, planeid.Cryostat);
+  }
+}
+
+#endif // LARDATAALG_DETECTORINFO_XTICKSTABLE_H
@@ -0,0 +1,87 @@
+/**
+ * @file   lardataalg/Utilities/AlignedAllocator.h
+ * @brief  Provides `util::AlignedAllocator` for over-aligned containers.
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_UTILITIES_ALIGNEDALLOCATOR_H
+#define LARDATAALG_UTILITIES_ALIGNEDALLOCATOR_H
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <limits> // std::numeric_limits<>
+#include <new> // std::align_val_t, std::bad_array_new_length
+
+namespace util {
+
+  /// Size of a cache line [bytes] assumed for data layout decisions.
+  constexpr std::size_t CacheLineSize = 64U;
+
+  /**
+   * @brief Allocator returning memory aligned to a fixed boundary.
+   * @tparam T type of the allocated elements
+   * @tparam Alignment required alignment of the storage [bytes]
+   *
+   * This allocator can be used with standard containers to force the start of
+   * their storage to a specific boundary, typically a cache line:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<double, util::AlignedAllocator<double>> data(24U);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * guarantees `data.data()` to be on a cache line boundary, so that a block of
+   * eight `double` starting at an index multiple of 8 spans a single line.
+   */
+  template <typename T, std::size_t Alignment = CacheLineSize>
+  struct AlignedAllocator {
+
+    static_assert((Alignment & (Alignment - 1U)) == 0U,
+                  "Alignment must be a power of 2");
+    static_assert(Alignment >= alignof(T),
+                  "Alignment can't be weaker than the natural one of the type");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+      using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    constexpr AlignedAllocator(AlignedAllocator<U, Alignment> const&) noexcept
+    {}
+
+    [[nodiscard]] T*
+    allocate(std::size_t const n)
+    {
+      if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        throw std::bad_array_new_length{};
+      return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void
+    deallocate(T* const p, std::size_t) noexcept
+    {
+      ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+  }; // struct AlignedAllocator
+
+  template <typename T, typename U, std::size_t Alignment>
+  constexpr bool
+  operator==(AlignedAllocator<T, Alignment> const&, AlignedAllocator<U, Alignment> const&) noexcept
+  {
+    return true;
+  }
+
+  template <typename T, typename U, std::size_t Alignment>
+  constexpr bool
+  operator!=(AlignedAllocator<T, Alignment> const&, AlignedAllocator<U, Alignment> const&) noexcept
+  {
+    return false;
+  }
+
+} // namespace util
+
+#endif // LARDATAALG_UTILITIES_ALIGNEDALLOCATOR_H
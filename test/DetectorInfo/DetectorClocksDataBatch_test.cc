@@ -0,0 +1,123 @@
+/**
+ * @file   DetectorClocksDataBatch_test.cc
+ * @brief  Test of the batch conversions of `detinfo::DetectorClocksData`.
+ * @see    `lardataalg/DetectorInfo/DetectorClocksData.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DetectorClocksDataBatch_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// C/C++ standard libraries
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// checks that `batch` gives the same results as `scalar` on all `values`
+template <typename Batch, typename Scalar>
+void checkBatch(std::vector<double> const& values, Batch batch, Scalar scalar) {
+
+  std::vector<double> results(values.size());
+  batch(values.data(), values.size(), results.data());
+  for (std::size_t i = 0; i < values.size(); ++i)
+    BOOST_TEST(results[i] == scalar(values[i]), boost::test_tools::tolerance(1e-12));
+
+  // in place
+  results = values;
+  batch(results.data(), results.size(), results.data());
+  for (std::size_t i = 0; i < values.size(); ++i)
+    BOOST_TEST(results[i] == scalar(values[i]), boost::test_tools::tolerance(1e-12));
+
+} // checkBatch()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( BatchConversionTestCase ) {
+
+  for (double const triggerOffsetTPC: { -1600.0, 3200.0 }) {
+
+    detinfo::DetectorClocksData const clockData{
+      -1100.0, triggerOffsetTPC, 1.25, 1.5,
+      detinfo::ElecClock{ 10.0, 1600.0, 2.0 },
+      detinfo::ElecClock{ 11.0, 1600.0, 64.0 },
+      detinfo::ElecClock{ 12.0, 1600.0, 16.0 },
+      detinfo::ElecClock{ 13.0, 1600.0, 31.25 }
+      };
+    detinfo::DetectorClocksData const& cd = clockData;
+
+    std::vector<double> const values{ -20.5, 0.25, 15.5, 1234.5, 4095.0, 1.0e6 };
+    std::size_t const sample = 12, frame = 3;
+
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.TPCTick2TrigTime(in, n, out); },
+      [&cd](double v){ return cd.TPCTick2TrigTime(v); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.TPCTick2BeamTime(in, n, out); },
+      [&cd](double v){ return cd.TPCTick2BeamTime(v); });
+    checkBatch(values,
+      [&](double const* in, std::size_t n, double* out)
+        { cd.OpticalTick2TrigTime(in, n, out, sample, frame); },
+      [&](double v){ return cd.OpticalTick2TrigTime(v, sample, frame); });
+    checkBatch(values,
+      [&](double const* in, std::size_t n, double* out)
+        { cd.OpticalTick2BeamTime(in, n, out, sample, frame); },
+      [&](double v){ return cd.OpticalTick2BeamTime(v, sample, frame); });
+    checkBatch(values,
+      [&](double const* in, std::size_t n, double* out)
+        { cd.ExternalTick2TrigTime(in, n, out, sample, frame); },
+      [&](double v){ return cd.ExternalTick2TrigTime(v, sample, frame); });
+    checkBatch(values,
+      [&](double const* in, std::size_t n, double* out)
+        { cd.ExternalTick2BeamTime(in, n, out, sample, frame); },
+      [&](double v){ return cd.ExternalTick2BeamTime(v, sample, frame); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.Time2Tick(in, n, out); },
+      [&cd](double v){ return cd.Time2Tick(v); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.TPCTick2TDC(in, n, out); },
+      [&cd](double v){ return cd.TPCTick2TDC(v); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.TPCG4Time2TDC(in, n, out); },
+      [&cd](double v){ return cd.TPCG4Time2TDC(v); });
+    checkBatch(values,
+      [&](double const* in, std::size_t n, double* out)
+        { cd.OpticalTick2TDC(in, n, out, sample, frame); },
+      [&](double v){ return cd.OpticalTick2TDC(v, sample, frame); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.OpticalG4Time2TDC(in, n, out); },
+      [&cd](double v){ return cd.OpticalG4Time2TDC(v); });
+    checkBatch(values,
+      [&](double const* in, std::size_t n, double* out)
+        { cd.ExternalTick2TDC(in, n, out, sample, frame); },
+      [&](double v){ return cd.ExternalTick2TDC(v, sample, frame); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.ExternalG4Time2TDC(in, n, out); },
+      [&cd](double v){ return cd.ExternalG4Time2TDC(v); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.TPCTick2Time(in, n, out); },
+      [&cd](double v){ return cd.TPCTick2Time(v); });
+    checkBatch(values,
+      [&](double const* in, std::size_t n, double* out)
+        { cd.OpticalTick2Time(in, n, out, sample, frame); },
+      [&](double v){ return cd.OpticalTick2Time(v, sample, frame); });
+    checkBatch(values,
+      [&](double const* in, std::size_t n, double* out)
+        { cd.ExternalTick2Time(in, n, out, sample, frame); },
+      [&](double v){ return cd.ExternalTick2Time(v, sample, frame); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.TPCTDC2Tick(in, n, out); },
+      [&cd](double v){ return cd.TPCTDC2Tick(v); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.TPCG4Time2Tick(in, n, out); },
+      [&cd](double v){ return cd.TPCG4Time2Tick(v); });
+    checkBatch(values,
+      [&cd](double const* in, std::size_t n, double* out){ cd.G4ToElecTime(in, n, out); },
+      [&cd](double v){ return cd.G4ToElecTime(v); });
+
+  } // for trigger offsets
+
+} // BOOST_AUTO_TEST_CASE( BatchConversionTestCase )
@@ -0,0 +1,145 @@
+/**
+ * @file   DetectorClocksDataConversion_test.cc
+ * @brief  Test of the time scale conversions of `detinfo::DetectorClocksData`.
+ * @see    `lardataalg/DetectorInfo/DetectorClocksData.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DetectorClocksDataConversion_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// C/C++ standard libraries
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+detinfo::DetectorClocksData makeClocks(double const triggerOffsetTPC) {
+  return {
+    -1100.0, triggerOffsetTPC, 1.25, 1.5,
+    detinfo::ElecClock{ 10.0, 1600.0, 2.0 },
+    detinfo::ElecClock{ 11.0, 1600.0, 64.0 },
+    detinfo::ElecClock{ 12.0, 1600.0, 16.0 },
+    detinfo::ElecClock{ 13.0, 1600.0, 31.25 }
+    };
+} // makeClocks()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( SingleValueTestCase ) {
+
+  // the single value conversions do not use the table: their results must be
+  // exactly the ones of their original formulas, since they are often
+  // truncated into tick and TDC bins
+  for (double const triggerOffsetTPC: { -1600.0, 3200.0 }) {
+    detinfo::DetectorClocksData const cd = makeClocks(triggerOffsetTPC);
+    double const tpcTime = cd.TriggerTime() + cd.ConfiguredTriggerOffsetTPC();
+    double const g4RefTime = -cd.G4ToElecTime(0.0);
+    double const tpcPeriod = cd.TPCClock().TickPeriod();
+    double const optPeriod = cd.OpticalClock().TickPeriod();
+    double const extPeriod = cd.ExternalClock().TickPeriod();
+    std::size_t const sample = 12, frame = 3;
+
+    BOOST_TEST(cd.TPCTime() == tpcTime);
+    for (double const v: { -20.5, 0.0, 0.25, 15.5, 1234.5, 4095.0, 1.0e6, 1600.0, 3200.0 }) {
+      BOOST_TEST(cd.G4ToElecTime(v) == v * 1.e-3 - g4RefTime);
+      BOOST_TEST(cd.TPCTick2TrigTime(v) == tpcPeriod * v + cd.TriggerOffsetTPC());
+      BOOST_TEST(cd.TPCTick2BeamTime(v)
+        == cd.TPCTick2TrigTime(v) + cd.TriggerTime() - cd.BeamGateTime());
+      BOOST_TEST(cd.OpticalTick2TrigTime(v, sample, frame)
+        == optPeriod * v + cd.OpticalClock().Time(sample, frame) - cd.TriggerTime());
+      BOOST_TEST(cd.ExternalTick2BeamTime(v, sample, frame)
+        == extPeriod * v + cd.ExternalClock().Time(sample, frame) - cd.BeamGateTime());
+      BOOST_TEST(cd.Time2Tick(v) == (v - tpcTime) / tpcPeriod);
+      BOOST_TEST(cd.TPCTick2TDC(v) == (tpcTime / tpcPeriod + v));
+      BOOST_TEST(cd.TPCG4Time2TDC(v) == cd.G4ToElecTime(v) / tpcPeriod);
+      BOOST_TEST(cd.OpticalG4Time2TDC(v) == cd.G4ToElecTime(v) / optPeriod);
+      BOOST_TEST(cd.ExternalG4Time2TDC(v) == cd.G4ToElecTime(v) / extPeriod);
+      BOOST_TEST(cd.TPCTick2Time(v) == tpcTime + v * tpcPeriod);
+      BOOST_TEST(cd.TPCTDC2Tick(v) == (v - tpcTime / tpcPeriod));
+      BOOST_TEST(cd.TPCG4Time2Tick(v) == (cd.G4ToElecTime(v) - tpcTime) / tpcPeriod);
+    } // for values
+  } // for trigger offsets
+
+} // BOOST_AUTO_TEST_CASE( SingleValueTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( FormulaTestCase ) {
+
+  using TimeScale = detinfo::DetectorClocksData::TimeScale;
+  auto const tol = boost::test_tools::tolerance(1e-12);
+
+  // TPC trigger offset in microseconds: all the formulas are consistent
+  detinfo::DetectorClocksData const cd = makeClocks(-1600.0);
+  double const tpcPeriod = cd.TPCClock().TickPeriod();
+  double const optPeriod = cd.OpticalClock().TickPeriod();
+  double const extPeriod = cd.ExternalClock().TickPeriod();
+
+  for (double const v: { -20.5, 0.25, 15.5, 1234.5, 4095.0, 1.0e6 }) {
+    BOOST_TEST(cd.Convert(v, TimeScale::Simulation, TimeScale::Electronics)
+      == v * 1.e-3 + cd.G4ToElecTime(0.0), tol);
+    BOOST_TEST(cd.Convert(v, TimeScale::Electronics, TimeScale::Trigger)
+      == v - cd.TriggerTime(), tol);
+    BOOST_TEST(cd.Convert(v, TimeScale::Electronics, TimeScale::BeamGate)
+      == v - cd.BeamGateTime(), tol);
+    BOOST_TEST(cd.Convert(v, TimeScale::Electronics, TimeScale::Simulation)
+      == (v - cd.G4ToElecTime(0.0)) * 1.e3, tol);
+    BOOST_TEST(cd.Convert(v, TimeScale::TPCTick, TimeScale::Electronics)
+      == cd.TPCTime() + v * tpcPeriod, tol);
+    BOOST_TEST(cd.Convert(v, TimeScale::TPCTick, TimeScale::Trigger)
+      == cd.TPCTime() + v * tpcPeriod - cd.TriggerTime(), tol);
+    BOOST_TEST(cd.Convert(v, TimeScale::TPCTDC, TimeScale::Electronics) == v * tpcPeriod, tol);
+    BOOST_TEST(cd.Convert(v, TimeScale::OpticalTDC, TimeScale::BeamGate)
+      == v * optPeriod - cd.BeamGateTime(), tol);
+    BOOST_TEST(cd.Convert(v, TimeScale::Simulation, TimeScale::ExternalTDC)
+      == cd.G4ToElecTime(v) / extPeriod, tol);
+  } // for values
+
+} // BOOST_AUTO_TEST_CASE( FormulaTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( RoundTripTestCase ) {
+
+  using TimeScale = detinfo::DetectorClocksData::TimeScale;
+  auto const tol = boost::test_tools::tolerance(1e-9);
+
+  std::vector<TimeScale> const scales{
+    TimeScale::Electronics, TimeScale::Trigger, TimeScale::BeamGate,
+    TimeScale::Simulation, TimeScale::TPCTick, TimeScale::TPCTDC,
+    TimeScale::OpticalTDC, TimeScale::ExternalTDC
+    };
+  BOOST_TEST(scales.size() == detinfo::DetectorClocksData::NTimeScales);
+
+  for (double const triggerOffsetTPC: { -1600.0, 3200.0 }) {
+    detinfo::DetectorClocksData const cd = makeClocks(triggerOffsetTPC);
+
+    for (TimeScale const from: scales) {
+      auto const& identity = cd.Conversion(from, from);
+      BOOST_TEST(identity.scale == 1.0);
+      BOOST_TEST(identity.shift == 0.0);
+
+      for (TimeScale const to: scales) {
+        for (double const v: { -20.5, 15.5, 1234.5 }) {
+          double const converted = cd.Convert(v, from, to);
+          BOOST_TEST(cd.Convert(converted, to, from) == v, tol);
+        }
+      } // for target scales
+    } // for source scales
+
+    // batch conversion, in place
+    std::vector<double> const values{ -20.5, 0.25, 15.5, 1234.5 };
+    std::vector<double> results = values;
+    cd.Convert(results.data(), results.size(), results.data(),
+      TimeScale::OpticalTDC, TimeScale::TPCTick);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      BOOST_TEST(results[i]
+        == cd.Convert(values[i], TimeScale::OpticalTDC, TimeScale::TPCTick));
+    }
+  } // for trigger offsets
+
+} // BOOST_AUTO_TEST_CASE( RoundTripTestCase )
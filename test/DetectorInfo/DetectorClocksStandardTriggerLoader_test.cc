@@ -0,0 +1,306 @@
+/**
+ * @file   DetectorClocksStandardTriggerLoader_test.cc
+ * @brief  Test of the trigger loaders of `detinfo::DetectorClocksStandard`.
+ * @see    `lardataalg/DetectorInfo/DetectorClocksStandardTriggerLoader.h`
+ *         `lardataalg/DetectorInfo/DetectorClocksStandardDataFor.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DetectorClocksStandardTriggerLoader_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksStandard.h"
+#include "lardataalg/DetectorInfo/DetectorClocksStandardDataFor.h"
+#include "lardataalg/DetectorInfo/DetectorClocksStandardTriggerLoader.h"
+#include "lardataobj/RawData/TriggerData.h"
+
+// framework libraries
+#include "canvas/Utilities/InputTag.h"
+#include "cetlib_except/exception.h"
+#include "fhiclcpp/ParameterSet.h"
+
+// C/C++ standard libraries
+#include <map>
+#include <string>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+/// Minimal event with the interface the trigger loaders need.
+struct MockEvent {
+
+  template <typename T>
+  struct HandleT {
+    T const* product = nullptr;
+    T const& operator*() const { return *product; }
+  };
+
+  std::map<std::string, std::vector<raw::Trigger>> products;
+  mutable unsigned int nLookups = 0U; ///< Number of `getByLabel()` calls.
+
+  template <typename T>
+  bool getByLabel(art::InputTag const& tag, HandleT<T>& handle) const {
+    ++nLookups;
+    auto const it = products.find(tag.encode());
+    if (it == products.end()) return false;
+    handle.product = &(it->second);
+    return true;
+  }
+
+}; // MockEvent
+
+
+// three triggers, the earliest in the middle
+MockEvent makeEvent() {
+  MockEvent event;
+  event.products["triggersim"] = {
+    raw::Trigger{ 1U, 9.0, 6.0, 0x1 },
+    raw::Trigger{ 2U, 5.0, 7.0, 0x3 },
+    raw::Trigger{ 3U, 7.0, 8.0, 0x2 }
+    };
+  event.products["empty"] = {};
+  event.products["g4ref"] = { raw::Trigger{ 4U, 4.0, 4.5, 0x1 } };
+  return event;
+} // makeEvent()
+
+
+fhicl::ParameterSet clocksConfiguration(
+  std::string const& g4RefTag, std::string const& selection, unsigned int const bits = 0U
+) {
+  fhicl::ParameterSet pset;
+  pset.put("G4RefTime", -1600.0);
+  pset.put("TriggerOffsetTPC", -1600.0);
+  pset.put("FramePeriod", 1600.0);
+  pset.put("ClockSpeedTPC", 2.0);
+  pset.put("ClockSpeedOptical", 64.0);
+  pset.put("ClockSpeedTrigger", 16.0);
+  pset.put("ClockSpeedExternal", 31.25);
+  pset.put("DefaultTrigTime", 1600.0);
+  pset.put("DefaultBeamTime", 1600.0);
+  pset.put("TrigModuleName", std::string{ "triggersim" });
+  pset.put("G4RefCorrTrigModuleName", g4RefTag);
+  pset.put("TriggerSelection", selection);
+  pset.put("TriggerSelectionBits", bits);
+  return pset;
+} // clocksConfiguration()
+
+
+// returns the trigger numbers of `triggers`
+std::vector<unsigned int> triggerNumbers(std::vector<raw::Trigger> const& triggers) {
+  std::vector<unsigned int> numbers;
+  for (raw::Trigger const& trigger: triggers) numbers.push_back(trigger.TriggerNumber());
+  return numbers;
+} // triggerNumbers()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( PolicyNameTestCase ) {
+
+  using Policy = detinfo::TriggerSelectionPolicy;
+
+  BOOST_TEST((Policy{}.mode == Policy::Mode::Single));
+  BOOST_TEST((Policy::fromName("Single").mode == Policy::Mode::Single));
+  BOOST_TEST((Policy::fromName("First").mode == Policy::Mode::First));
+  BOOST_TEST((Policy::fromName("Earliest").mode == Policy::Mode::Earliest));
+  BOOST_TEST((Policy::fromName("All").mode == Policy::Mode::All));
+
+  Policy const byBits = Policy::fromName("ByBits", 0x2);
+  BOOST_TEST((byBits.mode == Policy::Mode::ByBits));
+  BOOST_TEST(byBits.bits == 0x2U);
+
+  BOOST_CHECK_THROW(Policy::fromName("Latest"), cet::exception);
+  BOOST_CHECK_THROW(Policy::fromName("ByBits"), cet::exception); // no bits: all would match
+
+} // BOOST_AUTO_TEST_CASE( PolicyNameTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( SelectionModesTestCase ) {
+
+  using Policy = detinfo::TriggerSelectionPolicy;
+  using Numbers = std::vector<unsigned int>;
+
+  MockEvent const event = makeEvent();
+  art::InputTag const tag{ "triggersim" };
+
+  auto const selected = [&event, &tag](Policy const& policy)
+    { return triggerNumbers(detinfo::selected_triggers_for_event(tag, event, policy)); };
+
+  BOOST_TEST(selected(Policy::fromName("First")) == (Numbers{ 1U }));
+  BOOST_TEST(selected(Policy::fromName("Earliest")) == (Numbers{ 2U }));
+  BOOST_TEST(selected(Policy::fromName("ByBits", 0x2)) == (Numbers{ 2U, 3U }));
+  BOOST_TEST(selected(Policy::fromName("ByBits", 0x3)) == (Numbers{ 2U }));
+  BOOST_TEST(selected(Policy::fromName("All")) == (Numbers{ 1U, 2U, 3U }));
+
+  // only one trigger is allowed with the default policy
+  BOOST_CHECK_THROW(selected(Policy{}), cet::exception);
+  BOOST_CHECK_THROW(detinfo::trigger_times_for_event(tag, event), cet::exception);
+
+  // triggers exist, but none has the required bits
+  BOOST_CHECK_THROW(selected(Policy::fromName("ByBits", 0x4)), cet::exception);
+
+  // single trigger loaders
+  auto const earliest = detinfo::trigger_times_for_event(tag, event, Policy::fromName("Earliest"));
+  BOOST_TEST(earliest.has_value());
+  BOOST_TEST(earliest->first == 5.0);
+  BOOST_TEST(earliest->second == 7.0);
+  BOOST_TEST(*detinfo::g4ref_time_for_event(tag, event, Policy::fromName("First")) == 9.0);
+  BOOST_CHECK_THROW
+    (detinfo::trigger_times_for_event(tag, event, Policy::fromName("All")), cet::exception);
+  BOOST_CHECK_THROW
+    (detinfo::g4ref_time_for_event(tag, event, Policy::fromName("ByBits", 0x2)), cet::exception);
+
+} // BOOST_AUTO_TEST_CASE( SelectionModesTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( EmptyProductTestCase ) {
+
+  using Policy = detinfo::TriggerSelectionPolicy;
+
+  MockEvent const event = makeEvent();
+
+  // missing and empty data products quietly yield no trigger, whatever the policy
+  for (std::string const tag: { "empty", "missing" }) {
+    for (Policy const& policy: {
+      Policy{}, Policy::fromName("First"), Policy::fromName("Earliest"),
+      Policy::fromName("ByBits", 0x4), Policy::fromName("All")
+    }) {
+      BOOST_TEST(detinfo::selected_triggers_for_event(tag, event, policy).empty());
+      BOOST_TEST(!detinfo::trigger_times_for_event(tag, event, policy));
+      BOOST_TEST(!detinfo::g4ref_time_for_event(tag, event, policy));
+    } // for policies
+  } // for tags
+
+} // BOOST_AUTO_TEST_CASE( EmptyProductTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ClocksDataForTriggersTestCase ) {
+
+  MockEvent event = makeEvent();
+
+  // each trigger is its own G4 reference
+  {
+    detinfo::DetectorClocksStandard const detClocks
+      { clocksConfiguration("triggersim", "All") };
+    auto const data = detinfo::detectorClocksStandardDataForTriggers(detClocks, event);
+    BOOST_TEST(data.size() == 3U);
+    std::vector<double> const triggerTimes{ 9.0, 5.0, 7.0 };
+    std::vector<double> const beamGateTimes{ 6.0, 7.0, 8.0 };
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      BOOST_TEST(data[i].TriggerTime() == triggerTimes[i]);
+      BOOST_TEST(data[i].BeamGateTime() == beamGateTimes[i]);
+      BOOST_TEST(data[i].G4ToElecTime(0.0) == 1600.0);
+    }
+  }
+
+  // the G4 reference from a separate data product is the single trigger there
+  {
+    detinfo::DetectorClocksStandard const detClocks
+      { clocksConfiguration("g4ref", "ByBits", 0x2) };
+    auto const data = detinfo::detectorClocksStandardDataForTriggers(detClocks, event);
+    BOOST_TEST(data.size() == 2U);
+    BOOST_TEST(data[0].TriggerTime() == 5.0);
+    BOOST_TEST(data[1].TriggerTime() == 7.0);
+    BOOST_TEST(data[0].G4ToElecTime(0.0) == 1600.0 + 5.0 - 4.0);
+    BOOST_TEST(data[1].G4ToElecTime(0.0) == 1600.0 + 7.0 - 4.0);
+
+    auto const single = detinfo::detectorClocksStandardDataFor(
+      detinfo::DetectorClocksStandard{ clocksConfiguration("g4ref", "Earliest") }, event);
+    BOOST_TEST(single.TriggerTime() == 5.0);
+    BOOST_TEST(single.BeamGateTime() == 7.0);
+    BOOST_TEST(single.G4ToElecTime(0.0) == 1600.0 + 5.0 - 4.0);
+  }
+
+  // the readout policy does not apply to the G4 reference data product
+  {
+    event.products["g4multi"] = { raw::Trigger{ 5U, 4.0, 4.5 }, raw::Trigger{ 6U, 3.0, 3.5 } };
+    detinfo::DetectorClocksStandard const detClocks
+      { clocksConfiguration("g4multi", "First") };
+    BOOST_CHECK_THROW(detinfo::detectorClocksStandardDataFor(detClocks, event), cet::exception);
+    BOOST_CHECK_THROW
+      (detinfo::detectorClocksStandardDataForTriggers(detClocks, event), cet::exception);
+  }
+
+  // no trigger: default times
+  {
+    MockEvent const emptyEvent;
+    detinfo::DetectorClocksStandard const detClocks
+      { clocksConfiguration("triggersim", "All") };
+    auto const data = detinfo::detectorClocksStandardDataForTriggers(detClocks, emptyEvent);
+    BOOST_TEST(data.size() == 1U);
+    BOOST_TEST(data.front().TriggerTime() == 1600.0);
+    BOOST_TEST(data.front().BeamGateTime() == 1600.0);
+  }
+
+  // triggers exist, but none is selected: no silent fall back to the defaults
+  {
+    detinfo::DetectorClocksStandard const detClocks
+      { clocksConfiguration("triggersim", "ByBits", 0x4) };
+    BOOST_CHECK_THROW(detinfo::detectorClocksStandardDataFor(detClocks, event), cet::exception);
+    BOOST_CHECK_THROW
+      (detinfo::detectorClocksStandardDataForTriggers(detClocks, event), cet::exception);
+  }
+
+  // bad configuration
+  BOOST_CHECK_THROW(
+    detinfo::DetectorClocksStandard{ clocksConfiguration("triggersim", "ByBits") },
+    cet::exception);
+
+} // BOOST_AUTO_TEST_CASE( ClocksDataForTriggersTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ClockTimesLookupTestCase ) {
+
+  MockEvent event;
+  event.products["trigger"] = { raw::Trigger{ 1U, 5.0, 6.0 } };
+  event.products["g4ref"] = { raw::Trigger{ 2U, 7.0, 8.0 } };
+
+  // same tag for trigger and G4 reference: the data product is read once
+  auto const same = detinfo::clock_times_for_event("trigger", "trigger", event);
+  BOOST_TEST(event.nLookups == 1U);
+  BOOST_TEST(same.triggerAndBeamGate.has_value());
+  BOOST_TEST(same.triggerAndBeamGate->first == 5.0);
+  BOOST_TEST(same.triggerAndBeamGate->second == 6.0);
+  BOOST_TEST(same.g4RefTriggerTime.has_value());
+  BOOST_TEST(*same.g4RefTriggerTime == 5.0);
+
+  // different tags: each data product is read once
+  event.nLookups = 0U;
+  auto const different = detinfo::clock_times_for_event("trigger", "g4ref", event);
+  BOOST_TEST(event.nLookups == 2U);
+  BOOST_TEST(different.triggerAndBeamGate->first == 5.0);
+  BOOST_TEST(different.triggerAndBeamGate->second == 6.0);
+  BOOST_TEST(*different.g4RefTriggerTime == 7.0);
+
+  // the single value loaders return the same values, each reading its product
+  event.nLookups = 0U;
+  auto const triggerTimes = detinfo::trigger_times_for_event("trigger", event);
+  BOOST_TEST(event.nLookups == 1U);
+  BOOST_TEST((triggerTimes == different.triggerAndBeamGate));
+  BOOST_TEST((detinfo::g4ref_time_for_event("g4ref", event) == different.g4RefTriggerTime));
+  BOOST_TEST((detinfo::g4ref_time_for_event("trigger", event) == same.g4RefTriggerTime));
+
+  // missing data products
+  auto const missing = detinfo::clock_times_for_event("missing", "g4ref", event);
+  BOOST_TEST(!missing.triggerAndBeamGate);
+  BOOST_TEST(*missing.g4RefTriggerTime == 7.0);
+  BOOST_TEST(!detinfo::trigger_times_for_event("missing", event));
+  BOOST_TEST(!detinfo::g4ref_time_for_event("missing", event));
+
+  // the provider helper reads the data product once when the tags are the same
+  event.products["triggersim"] = event.products["trigger"];
+  for (std::string const g4RefTag: { "triggersim", "g4ref" }) {
+    detinfo::DetectorClocksStandard const detClocks{ clocksConfiguration(g4RefTag, "Single") };
+    event.nLookups = 0U;
+    detinfo::DetectorClocksData const clockData
+      = detinfo::detectorClocksStandardDataFor(detClocks, event);
+    BOOST_TEST(event.nLookups == ((g4RefTag == "triggersim")? 1U: 2U));
+    BOOST_TEST(clockData.TriggerTime() == 5.0);
+    BOOST_TEST(clockData.BeamGateTime() == 6.0);
+  } // for G4 reference tags
+
+} // BOOST_AUTO_TEST_CASE( ClockTimesLookupTestCase )
@@ -0,0 +1,265 @@
+/**
+ * @file   DetectorInfoSnapshot_test.cc
+ * @brief  Test of `detinfo::DetectorInfoSnapshot`.
+ * @see    `lardataalg/DetectorInfo/DetectorInfoSnapshot.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DetectorInfoSnapshot_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorInfoSnapshot.h"
+#include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint64_t
+#include <cstdio>  // std::remove()
+#include <fstream>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// minimal provider with constant values
+class MockDetectorProperties: public detinfo::DetectorProperties {
+public:
+  double fEfield = 0.5;
+
+  double Efield(unsigned int = 0) const override { return fEfield; }
+  double DriftVelocity(double = 0., double = 0.) const override { return 0.16; }
+  double BirksCorrection(double dQdX) const override { return dQdX; }
+  double BirksCorrection(double dQdX, double) const override { return dQdX; }
+  double ModBoxCorrection(double dQdX) const override { return dQdX; }
+  double ModBoxCorrection(double dQdX, double) const override { return dQdX; }
+  double ElectronLifetime() const override { return 3000.0; }
+  double Density(double) const override { return 1.39; }
+  double Temperature() const override { return 87.0; }
+  double Eloss(double, double, double) const override { return 2.1; }
+  double ElossVar(double, double) const override { return 0.1; }
+  double ElectronsToADC() const override { return 6.8906513e-3; }
+  unsigned int NumberTimeSamples() const override { return 4492; }
+  unsigned int ReadOutWindowSize() const override { return 4492; }
+  double TimeOffsetU() const override { return 0.0; }
+  double TimeOffsetV() const override { return -4.5; }
+  double TimeOffsetZ() const override { return -9.0; }
+  bool SimpleBoundary() const override { return true; }
+  detinfo::DetectorPropertiesData DataFor(detinfo::DetectorClocksData const&) const override
+    { return makeData(); }
+
+  detinfo::DetectorPropertiesData makeData() const {
+    std::vector<std::vector<std::vector<double>>> const offsets{
+      { { 10.0, 11.0, 12.0 }, { 20.0, 21.0, 22.0 } },
+      { { 30.0, 31.0 } }
+      };
+    std::vector<std::vector<double>> const directions{ { +1.0, -1.0 }, { +1.0 } };
+    return detinfo::DetectorPropertiesData{
+      *this, 0.08, detinfo::XTicksTable{ 0.08, offsets, directions }
+      };
+  }
+}; // MockDetectorProperties
+
+
+detinfo::DetectorClocksData makeClocks(double const triggerOffsetTPC = -1600.0) {
+  return {
+    -1100.0, triggerOffsetTPC, 1.25, 1.5,
+    detinfo::ElecClock{ 10.0, 1600.0, 2.0 },
+    detinfo::ElecClock{ 11.0, 1600.0, 64.0 },
+    detinfo::ElecClock{ 12.0, 1600.0, 16.0 },
+    detinfo::ElecClock{ 13.0, 1600.0, 31.25 }
+    };
+} // makeClocks()
+
+
+std::uint64_t const Checksum
+  = detinfo::DetectorInfoSnapshot::ConfigurationChecksum("DetectorInfoSnapshot_test");
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( RoundTripTestCase ) {
+
+  std::string const fileName = "DetectorInfoSnapshot_test_roundtrip.bin";
+
+  MockDetectorProperties const detProp;
+  detinfo::DetectorClocksData const clockData = makeClocks();
+  detinfo::DetectorPropertiesData const propData = detProp.makeData();
+
+  detinfo::DetectorInfoSnapshot::Write(fileName, clockData, propData, Checksum);
+  detinfo::DetectorInfoSnapshot const snapshot{ fileName, Checksum };
+  std::remove(fileName.c_str());
+
+  BOOST_TEST(snapshot.ConfigChecksum() == Checksum);
+
+  detinfo::DetectorClocksData const& loadedClocks = snapshot.ClocksData();
+  BOOST_TEST(loadedClocks.G4ToElecTime(0.0) == clockData.G4ToElecTime(0.0));
+  BOOST_TEST(loadedClocks.TriggerOffsetTPC() == clockData.TriggerOffsetTPC());
+  BOOST_TEST(loadedClocks.TriggerTime() == clockData.TriggerTime());
+  BOOST_TEST(loadedClocks.BeamGateTime() == clockData.BeamGateTime());
+  BOOST_TEST(loadedClocks.TPCClock().Time() == clockData.TPCClock().Time());
+  BOOST_TEST(loadedClocks.TPCClock().Frequency() == clockData.TPCClock().Frequency());
+  BOOST_TEST(loadedClocks.OpticalClock().FramePeriod() == clockData.OpticalClock().FramePeriod());
+  BOOST_TEST(loadedClocks.TriggerClock().Frequency() == clockData.TriggerClock().Frequency());
+  BOOST_TEST(loadedClocks.ExternalClock().Time() == clockData.ExternalClock().Time());
+  BOOST_TEST(loadedClocks.TPCTick2TDC(100.0) == clockData.TPCTick2TDC(100.0));
+
+  detinfo::DetectorPropertiesData const loadedProp = snapshot.PropertiesData(detProp);
+  BOOST_TEST(loadedProp.GetXTicksCoefficient() == propData.GetXTicksCoefficient());
+  BOOST_TEST(loadedProp.NumberTimeSamples() == propData.NumberTimeSamples());
+  BOOST_TEST(loadedProp.TimeOffsetV() == propData.TimeOffsetV());
+
+  detinfo::XTicksTable const& table = propData.XTicks();
+  detinfo::XTicksTable const& loadedTable = loadedProp.XTicks();
+  BOOST_TEST(loadedTable.NCryostats() == table.NCryostats());
+  for (unsigned int c = 0; c < table.NCryostats(); ++c) {
+    BOOST_TEST(loadedTable.NTPCs(c) == table.NTPCs(c));
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t) {
+      BOOST_TEST(loadedTable.NPlanes(t, c) == table.NPlanes(t, c));
+      BOOST_TEST(loadedTable.Coefficient(t, c) == table.Coefficient(t, c));
+      for (unsigned int p = 0; p < table.NPlanes(t, c); ++p) {
+        BOOST_TEST(loadedTable.Offset(p, t, c) == table.Offset(p, t, c));
+        BOOST_TEST(loadedProp.ConvertTicksToX(500.0, p, t, c)
+          == propData.ConvertTicksToX(500.0, p, t, c));
+      }
+    } // for TPCs
+  } // for cryostats
+
+  // a provider with different constants is rejected
+  MockDetectorProperties otherDetProp;
+  otherDetProp.fEfield = 0.4;
+  BOOST_CHECK_THROW(snapshot.PropertiesData(otherDetProp), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE( RoundTripTestCase )
+
+
+//------------------------------------------------------------------------------
+// provider also implementing the time offset of view Y
+class MockDetectorPropertiesWithY: public MockDetectorProperties {
+public:
+  double fTimeOffsetY = -13.5;
+
+  double TimeOffsetY() const override { return fTimeOffsetY; }
+}; // MockDetectorPropertiesWithY
+
+
+BOOST_AUTO_TEST_CASE( TimeOffsetYTestCase ) {
+
+  std::string const fileName = "DetectorInfoSnapshot_test_timeoffsety.bin";
+
+  MockDetectorPropertiesWithY const detProp;
+  detinfo::DetectorInfoSnapshot::Write(fileName, makeClocks(), detProp.makeData(), Checksum);
+  detinfo::DetectorInfoSnapshot const snapshot{ fileName, Checksum };
+  std::remove(fileName.c_str());
+
+  detinfo::DetectorPropertiesData const loadedProp = snapshot.PropertiesData(detProp);
+  BOOST_TEST(loadedProp.HasTimeOffsetY());
+  BOOST_TEST(loadedProp.TimeOffsetY() == -13.5);
+
+  // a different offset is rejected...
+  MockDetectorPropertiesWithY otherDetProp;
+  otherDetProp.fTimeOffsetY = -12.0;
+  BOOST_CHECK_THROW(snapshot.PropertiesData(otherDetProp), std::runtime_error);
+
+  // ... and so is a provider without it, and vice versa
+  MockDetectorProperties const noYDetProp;
+  BOOST_CHECK_THROW(snapshot.PropertiesData(noYDetProp), std::runtime_error);
+
+  detinfo::DetectorInfoSnapshot::Write(fileName, makeClocks(), noYDetProp.makeData(), Checksum);
+  detinfo::DetectorInfoSnapshot const noYSnapshot{ fileName, Checksum };
+  std::remove(fileName.c_str());
+  BOOST_TEST(!noYSnapshot.PropertiesData(noYDetProp).HasTimeOffsetY());
+  BOOST_CHECK_THROW(noYSnapshot.PropertiesData(detProp), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE( TimeOffsetYTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( TickTriggerOffsetTestCase ) {
+
+  // a positive TPC trigger offset is in ticks, and it must be kept as such
+  std::string const fileName = "DetectorInfoSnapshot_test_tickoffset.bin";
+
+  MockDetectorProperties const detProp;
+  detinfo::DetectorClocksData const clockData = makeClocks(3200.0);
+
+  detinfo::DetectorInfoSnapshot::Write(fileName, clockData, detProp.makeData(), Checksum);
+  detinfo::DetectorInfoSnapshot const snapshot{ fileName, Checksum };
+  std::remove(fileName.c_str());
+
+  detinfo::DetectorClocksData const& loadedClocks = snapshot.ClocksData();
+  BOOST_TEST(loadedClocks.ConfiguredTriggerOffsetTPC() == 3200.0);
+  BOOST_TEST(loadedClocks.TriggerOffsetTPC() == clockData.TriggerOffsetTPC());
+  BOOST_TEST(loadedClocks.TPCTime() == clockData.TPCTime());
+  for (double const tick: { -20.0, 0.5, 1234.5 }) {
+    BOOST_TEST(loadedClocks.TPCTick2Time(tick) == clockData.TPCTick2Time(tick));
+    BOOST_TEST(loadedClocks.TPCTick2TrigTime(tick) == clockData.TPCTick2TrigTime(tick));
+    BOOST_TEST(loadedClocks.Time2Tick(tick) == clockData.Time2Tick(tick));
+  }
+
+} // BOOST_AUTO_TEST_CASE( TickTriggerOffsetTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ValidationTestCase ) {
+
+  std::string const fileName = "DetectorInfoSnapshot_test_validation.bin";
+
+  MockDetectorProperties const detProp;
+  detinfo::DetectorInfoSnapshot::Write(fileName, makeClocks(), detProp.makeData(), Checksum);
+
+  // different configuration
+  BOOST_CHECK_THROW((detinfo::DetectorInfoSnapshot{ fileName, Checksum + 1 }), std::runtime_error);
+
+  // corrupted payload: flip a bit of the first clock value
+  {
+    std::fstream file{ fileName, std::ios::binary | std::ios::in | std::ios::out };
+    file.seekg(6 * 8);
+    char byte;
+    file.read(&byte, 1);
+    byte ^= 0x10;
+    file.seekp(6 * 8);
+    file.write(&byte, 1);
+  }
+  BOOST_CHECK_THROW((detinfo::DetectorInfoSnapshot{ fileName, Checksum }), std::runtime_error);
+
+  // number of TPCs in the header not matching the ones in the cryostats,
+  // with a valid payload checksum
+  detinfo::DetectorInfoSnapshot::Write(fileName, makeClocks(), detProp.makeData(), Checksum);
+  {
+    std::vector<std::uint64_t> words;
+    {
+      std::ifstream file{ fileName, std::ios::binary };
+      std::uint64_t word;
+      while (file.read(reinterpret_cast<char*>(&word), sizeof(word))) words.push_back(word);
+    }
+    BOOST_TEST_REQUIRE(words.size() > 39U);
+    BOOST_TEST(words[36] == 2U); // cryostats
+    BOOST_TEST(words[37] == 3U); // TPCs
+    BOOST_TEST(words[38] == 8U); // planes
+    words[37] = 4U;
+    // the payload checksum is the same FNV-1a hash as the configuration one
+    std::string const payload{
+      reinterpret_cast<char const*>(words.data() + 6), (words.size() - 6) * sizeof(std::uint64_t)
+      };
+    words[4] = detinfo::DetectorInfoSnapshot::ConfigurationChecksum(payload);
+    std::ofstream file{ fileName, std::ios::binary };
+    file.write(reinterpret_cast<char const*>(words.data()), words.size() * sizeof(std::uint64_t));
+  }
+  BOOST_CHECK_THROW((detinfo::DetectorInfoSnapshot{ fileName, Checksum }), std::runtime_error);
+
+  // not a snapshot at all
+  {
+    std::ofstream file{ fileName, std::ios::binary };
+    file << "this is not a snapshot";
+  }
+  BOOST_CHECK_THROW((detinfo::DetectorInfoSnapshot{ fileName, Checksum }), std::runtime_error);
+  std::remove(fileName.c_str());
+
+  // missing file
+  BOOST_CHECK_THROW((detinfo::DetectorInfoSnapshot{ fileName, Checksum }), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE( ValidationTestCase )
@@ -0,0 +1,404 @@
+/**
+ * @file   DetectorInfo_benchmark.cc
+ * @brief  Timing of the most used detector properties and clocks methods.
+ * @see    `lardataalg/DetectorInfo/DetectorPropertiesStandard.h`,
+ *         `lardataalg/DetectorInfo/DetectorClocksData.h`
+ *
+ * Usage:
+ *
+ *     DetectorInfo_benchmark ConfigFile [OutputFile] [NCalls] [NRepetitions]
+ *
+ * The providers are set up from the FHiCL configuration in `ConfigFile`
+ * (e.g. `benchmark_bo.fcl`). Each method is called `NCalls` times (default:
+ * one million), and the best time out of `NRepetitions` (default: 5) is
+ * kept. A table is printed on screen, and the results are written in JSON
+ * format into `OutputFile` (default: `DetectorInfo_benchmark.json`):
+ *
+ *     {
+ *       "config": "benchmark_bo.fcl",
+ *       "instrumentation": 0,
+ *       "calls": 1000000,
+ *       "repetitions": 5,
+ *       "results": [
+ *         { "name": "ConvertTicksToX", "ns_per_call": 1.234 },
+ *         ...
+ *       ]
+ *     }
+ *
+ * The instrumentation level is the one this program is compiled with (see
+ * `lardataalg/DetectorInfo/ProviderInstrumentation.h`), which is expected to
+ * match the one of the library. The cost of the instrumentation is measured
+ * by comparing the results of builds with different levels; in addition, the
+ * "instrumented call" and "plain call" entries time an instrumented empty
+ * function against the same function without instrumentation. Timings are
+ * only reported: with the instrumentation disabled, it is checked at compile
+ * time that the instrumentation leaves no code behind.
+ *
+ * This program is not a test: it is built and run, with `benchmark_bo.fcl`,
+ * only by the `benchmark` target of the build (e.g. `make benchmark`).
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorClocksStandardTestHelpers.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesStandardTestHelpers.h"
+#include "lardataalg/DetectorInfo/HitTimeConverter.h"
+#include "lardataalg/DetectorInfo/LArPropertiesStandardTestHelpers.h"
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "test/Geometry/geometry_unit_test_base.h"
+
+// C/C++ standard libraries
+#include <chrono>
+#include <cstdlib> // std::strtoul()
+#include <fstream>
+#include <iomanip> // std::setw()
+#include <iostream>
+#include <limits> // std::numeric_limits<>
+#include <string>
+#include <type_traits> // std::is_void_v
+#include <utility>     // std::pair
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using TesterConfiguration =
+  testing::BasicGeometryEnvironmentConfiguration<geo::ChannelMapStandardAlg>;
+using TestEnvironment = testing::GeometryTesterEnvironment<TesterConfiguration>;
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Times a set of methods and collects the results.
+  class Benchmark {
+  public:
+    Benchmark(std::size_t const nCalls, unsigned int const nRepetitions)
+      : fNCalls{nCalls}, fNRepetitions{nRepetitions}
+    {}
+
+    std::size_t
+    NCalls() const
+    {
+      return fNCalls;
+    }
+
+    /// Runs `f` (which performs `NCalls()` calls), records and returns the best time [ns/call].
+    template <typename F>
+    double
+    run(std::string const& name, F&& f)
+    {
+      using clock_t = std::chrono::steady_clock;
+      double best = std::numeric_limits<double>::max();
+      for (unsigned int i = 0; i < fNRepetitions; ++i) {
+        auto const start = clock_t::now();
+        fSink += f();
+        std::chrono::duration<double> const elapsed = clock_t::now() - start;
+        if (elapsed.count() < best) best = elapsed.count();
+      }
+      double const nsPerCall = best * 1e9 / fNCalls;
+      fResults.emplace_back(name, nsPerCall);
+      std::cout << std::setw(36) << name << ": " << std::setw(10) << nsPerCall << " ns/call"
+                << std::endl;
+      return nsPerCall;
+    }
+
+    /// Writes the results in JSON format.
+    void
+    writeJSON(std::ostream& out, std::string const& configPath) const
+    {
+      out << "{\n  \"config\": \"" << configPath
+          << "\",\n  \"instrumentation\": " << detinfo::instrumentation::Level
+          << ",\n  \"calls\": " << fNCalls
+          << ",\n  \"repetitions\": " << fNRepetitions << ",\n  \"results\": [";
+      for (std::size_t i = 0; i < fResults.size(); ++i) {
+        out << ((i == 0) ? "\n" : ",\n") << "    { \"name\": \"" << fResults[i].first
+            << "\", \"ns_per_call\": " << fResults[i].second << " }";
+      }
+      out << "\n  ]\n}\n";
+    }
+
+    /// Sum of all the results, to keep the compiler from skipping the calls.
+    double
+    sink() const
+    {
+      return fSink;
+    }
+
+  private:
+    std::size_t fNCalls;
+    unsigned int fNRepetitions;
+    std::vector<std::pair<std::string, double>> fResults;
+    double fSink = 0.0;
+  }; // class Benchmark
+
+  /// Returns the sum of all the `values`.
+  double
+  sum(std::vector<double> const& values)
+  {
+    double s = 0.0;
+    for (double const value : values)
+      s += value;
+    return s;
+  }
+
+  /// A trivial function, instrumented like the provider methods.
+  double
+  instrumentedCall(double const value)
+  {
+    DETINFO_INSTRUMENTED_CALL("DetectorInfo_benchmark::instrumentedCall");
+    return value * 1.5;
+  }
+
+#if LARDATAALG_DETECTORINFO_INSTRUMENTATION == 0
+  // disabled instrumentation is a void expression: no object, no call
+  static_assert(std::is_void_v<decltype(DETINFO_INSTRUMENTED_CALL("disabled"))>);
+#endif
+
+  /// The same trivial function, not instrumented.
+  double
+  plainCall(double const value)
+  {
+    return value * 1.5;
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int
+main(int argc, char const** argv)
+{
+  TesterConfiguration config("detinfo_benchmark");
+
+  //
+  // parameter parsing
+  //
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  std::string configPath;
+  if (++iParam < argc) {
+    configPath = argv[iParam];
+    config.SetConfigurationPath(configPath);
+  }
+  else {
+    std::cerr << "FHiCL configuration file path required as first argument!" << std::endl;
+    return 1;
+  }
+
+  std::string const outputPath =
+    (++iParam < argc) ? argv[iParam] : "DetectorInfo_benchmark.json";
+  std::size_t const nCalls =
+    (++iParam < argc) ? std::strtoul(argv[iParam], nullptr, 10) : 1'000'000U;
+  unsigned int const nRepetitions =
+    (++iParam < argc) ? std::strtoul(argv[iParam], nullptr, 10) : 5U;
+
+  //
+  // testing environment setup
+  //
+  TestEnvironment TestEnv(config);
+
+  TestEnv.SimpleProviderSetup<detinfo::LArPropertiesStandard>();
+  TestEnv.SimpleProviderSetup<detinfo::DetectorClocksStandard>();
+  TestEnv.SimpleProviderSetup<detinfo::DetectorPropertiesStandard>();
+
+  auto const& geom = *TestEnv.Provider<geo::GeometryCore>();
+  auto const& detp = *TestEnv.Provider<detinfo::DetectorProperties>();
+  detinfo::DetectorClocksData const clockData =
+    TestEnv.Provider<detinfo::DetectorClocks>()->DataForJob();
+  detinfo::DetectorPropertiesData const detProp = detp.DataFor(clockData);
+
+  //
+  // input values
+  //
+  geo::PlaneID plane; // the last one
+  for (geo::PlaneID const& planeID : geom.IteratePlaneIDs())
+    plane = planeID;
+
+  std::size_t const nReadoutTicks = detProp.ReadOutWindowSize();
+  std::vector<double> ticks(nCalls), x(nCalls), momenta(nCalls), dQdX(nCalls), efields(nCalls);
+  std::vector<double> times(nCalls);
+  std::vector<double> results(nCalls);
+  for (std::size_t i = 0; i < nCalls; ++i) {
+    ticks[i] = static_cast<double>(i % nReadoutTicks) + 0.25;
+    x[i] = detProp.ConvertTicksToX(ticks[i], plane);
+    times[i] = clockData.TPCTick2Time(ticks[i]);
+    momenta[i] = 0.05 + 0.001 * (i % 5000); // GeV/c
+    dQdX[i] = 20000.0 + 10.0 * (i % 10000); // electrons/cm
+    efields[i] = 0.1 + 0.01 * (i % 8);      // a few values, kV/cm
+  }
+  double const muonMass = 0.1056583755; // GeV/c^2
+
+  //
+  // the benchmarks
+  //
+  Benchmark benchmark{nCalls, nRepetitions};
+  std::cout << "Running " << nCalls << " calls (best of " << nRepetitions << " runs) with "
+            << configPath << std::endl;
+
+  // --- drift coordinate/ticks conversions
+  benchmark.run("ConvertTicksToX", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detProp.ConvertTicksToX(ticks[i], plane);
+    return s;
+  });
+  benchmark.run("ConvertTicksToX (batch)", [&] {
+    detProp.ConvertTicksToX(ticks.data(), nCalls, results.data(), plane);
+    return sum(results);
+  });
+  benchmark.run("ConvertXToTicks", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detProp.ConvertXToTicks(x[i], plane);
+    return s;
+  });
+  benchmark.run("ConvertXToTicks (batch)", [&] {
+    detProp.ConvertXToTicks(x.data(), nCalls, results.data(), plane);
+    return sum(results);
+  });
+
+  // --- electronics time to drift coordinate
+  benchmark.run("ElecTimeToX (chained)", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detProp.ConvertTicksToX(clockData.Time2Tick(times[i]), plane);
+    return s;
+  });
+  detinfo::HitTimeConverter const converter{clockData, detProp};
+  benchmark.run("ElecTimeToX (fused)", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += converter.ElecTimeToX(times[i], plane);
+    return s;
+  });
+  benchmark.run("ElecTimeToX (fused, batch)", [&] {
+    converter.ElecTimeToX(times.data(), nCalls, results.data(), plane);
+    return sum(results);
+  });
+
+  // --- physics
+  benchmark.run("Eloss", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detp.Eloss(momenta[i], muonMass, 0.0);
+    return s;
+  });
+  benchmark.run("Eloss (batch)", [&] {
+    detp.Eloss(momenta.data(), nCalls, results.data(), muonMass, 0.0);
+    return sum(results);
+  });
+  benchmark.run("DriftVelocity (configured)", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detp.DriftVelocity();
+    return s;
+  });
+  benchmark.run("DriftVelocity (field)", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detp.DriftVelocity(efields[i], 87.0);
+    return s;
+  });
+  benchmark.run("BirksCorrection", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detProp.BirksCorrection(dQdX[i]);
+    return s;
+  });
+  benchmark.run("BirksCorrection (batch)", [&] {
+    detProp.BirksCorrection(dQdX.data(), nCalls, results.data());
+    return sum(results);
+  });
+  benchmark.run("ModBoxCorrection", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detProp.ModBoxCorrection(dQdX[i]);
+    return s;
+  });
+  benchmark.run("ModBoxCorrection (batch)", [&] {
+    detProp.ModBoxCorrection(dQdX.data(), nCalls, results.data());
+    return sum(results);
+  });
+
+  // --- properties for an event
+  benchmark.run("DataFor", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += detp.DataFor(clockData).Efield();
+    return s;
+  });
+
+  // --- clocks
+  benchmark.run("TPCTick2TrigTime", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += clockData.TPCTick2TrigTime(ticks[i]);
+    return s;
+  });
+  benchmark.run("TPCTick2TrigTime (batch)", [&] {
+    clockData.TPCTick2TrigTime(ticks.data(), nCalls, results.data());
+    return sum(results);
+  });
+  benchmark.run("TPCTick2Time", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += clockData.TPCTick2Time(ticks[i]);
+    return s;
+  });
+  benchmark.run("Time2Tick", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += clockData.Time2Tick(ticks[i]);
+    return s;
+  });
+  benchmark.run("TPCG4Time2Tick", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += clockData.TPCG4Time2Tick(ticks[i]);
+    return s;
+  });
+  benchmark.run("OpticalTick2BeamTime", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += clockData.OpticalTick2BeamTime(ticks[i], 0U, 1U);
+    return s;
+  });
+  benchmark.run("OpticalTick2BeamTime (batch)", [&] {
+    clockData.OpticalTick2BeamTime(ticks.data(), nCalls, results.data(), 0U, 1U);
+    return sum(results);
+  });
+
+  // --- instrumentation
+  double const instrumentedTime = benchmark.run("instrumented call", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += instrumentedCall(ticks[i]);
+    return s;
+  });
+  double const plainTime = benchmark.run("plain call", [&] {
+    double s = 0.0;
+    for (std::size_t i = 0; i < nCalls; ++i)
+      s += plainCall(ticks[i]);
+    return s;
+  });
+
+  std::cout << "Instrumentation (level " << detinfo::instrumentation::Level
+            << ") overhead: " << (instrumentedTime - plainTime) << " ns/call" << std::endl;
+
+  std::ofstream outputFile{outputPath};
+  benchmark.writeJSON(outputFile, configPath);
+  if (!outputFile) {
+    std::cerr << "Failed to write the results into '" << outputPath << "'" << std::endl;
+    return 1;
+  }
+  std::cout << "Results written into '" << outputPath << "' (checksum: " << benchmark.sink()
+            << ")" << std::endl;
+
+  return 0;
+} // main()
@@ -0,0 +1,193 @@
+/**
+ * @file   DetectorPropertiesConcurrency_test.cc
+ * @brief  Stress test of concurrent `DetectorPropertiesStandard::DataFor()`.
+ * @see    `lardataalg/DetectorInfo/DetectorPropertiesStandard.h`
+ *
+ * Many threads request the detector properties for a number of clock settings
+ * larger than the provider keeps, while another thread changes the number of
+ * time samples. Each result is compared with the one computed before the
+ * threads start.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorClocksStandardTestHelpers.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesStandardTestHelpers.h"
+#include "lardataalg/DetectorInfo/LArPropertiesStandardTestHelpers.h"
+#include "test/Geometry/geometry_unit_test_base.h"
+
+// framework libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cstdlib> // std::atoi()
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using TesterConfiguration =
+  testing::BasicGeometryEnvironmentConfiguration<geo::ChannelMapStandardAlg>;
+using TestEnvironment = testing::GeometryTesterEnvironment<TesterConfiguration>;
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Returns a copy of `clock_data` with the TPC trigger offset at `ticks`.
+  detinfo::DetectorClocksData
+  withTriggerOffset(detinfo::DetectorClocksData const& clock_data, double const ticks)
+  {
+    return {-clock_data.G4ToElecTime(0.),
+            ticks,
+            clock_data.TriggerTime(),
+            clock_data.BeamGateTime(),
+            clock_data.TPCClock(),
+            clock_data.OpticalClock(),
+            clock_data.TriggerClock(),
+            clock_data.ExternalClock()};
+  }
+
+  /// Returns whether the two data have the same conversion parameters.
+  bool
+  sameConversions(detinfo::DetectorPropertiesData const& a,
+                  detinfo::DetectorPropertiesData const& b)
+  {
+    detinfo::XTicksTable const& ta = a.XTicks();
+    detinfo::XTicksTable const& tb = b.XTicks();
+    if (ta.NCryostats() != tb.NCryostats()) return false;
+    for (unsigned int c = 0; c < ta.NCryostats(); ++c) {
+      if (ta.NTPCs(c) != tb.NTPCs(c)) return false;
+      for (unsigned int t = 0; t < ta.NTPCs(c); ++t) {
+        if (ta.Coefficient(t, c) != tb.Coefficient(t, c)) return false;
+        if (ta.NPlanes(t, c) != tb.NPlanes(t, c)) return false;
+        for (unsigned int p = 0; p < ta.NPlanes(t, c); ++p)
+          if (ta.Offset(p, t, c) != tb.Offset(p, t, c)) return false;
+      }
+    }
+    return true;
+  }
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("DetectorPropertiesConcurrency_test")
+ * 1. (mandatory) path to the FHiCL configuration file
+ * 2. number of reading threads (default: 16)
+ * 3. number of requests per thread (default: 10000)
+ *
+ */
+//------------------------------------------------------------------------------
+int
+main(int argc, char const** argv)
+{
+
+  TesterConfiguration config("detp_concurrency_test");
+
+  //
+  // parameter parsing
+  //
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    config.SetConfigurationPath(argv[iParam]);
+  else {
+    std::cerr << "FHiCL configuration file path required as first argument!" << std::endl;
+    return 1;
+  }
+
+  unsigned int nThreads = 16U;
+  if (++iParam < argc) nThreads = std::atoi(argv[iParam]);
+
+  unsigned int nRequests = 10000U;
+  if (++iParam < argc) nRequests = std::atoi(argv[iParam]);
+
+  //
+  // testing environment setup
+  //
+  TestEnvironment TestEnv(config);
+
+  TestEnv.SimpleProviderSetup<detinfo::LArPropertiesStandard>();
+  TestEnv.SimpleProviderSetup<detinfo::DetectorClocksStandard>();
+  // the test needs to change the provider: we keep the non-constant pointer
+  auto& detp = *TestEnv.SimpleProviderSetup<detinfo::DetectorPropertiesStandard>();
+
+  auto const clock_data = TestEnv.Provider<detinfo::DetectorClocks>()->DataForJob();
+
+  //
+  // reference values, computed serially
+  //
+  // more clock settings than the provider keeps, so that some are computed at each call
+  std::size_t const nSettings = detinfo::DetectorPropertiesStandard::MaxDataCacheSize + 4U;
+  std::vector<detinfo::DetectorClocksData> settings;
+  std::vector<detinfo::DetectorPropertiesData> expected;
+  for (std::size_t i = 0; i < nSettings; ++i) {
+    settings.push_back(withTriggerOffset(clock_data, 100.0 * (i + 1)));
+    expected.push_back(detp.DataFor(settings.back()));
+  }
+
+  unsigned int const samplesA = detp.NumberTimeSamples();
+  unsigned int const samplesB = samplesA + 1U;
+
+  //
+  // the stress
+  //
+  std::atomic<unsigned int> nErrors{0U};
+  std::atomic<unsigned int> nRunning{nThreads};
+
+  std::vector<std::thread> readers;
+  for (unsigned int iThread = 0; iThread < nThreads; ++iThread) {
+    readers.emplace_back([&, iThread]() {
+      unsigned int errors = 0U;
+      for (unsigned int i = 0; i < nRequests; ++i) {
+        std::size_t const iSetting = (iThread + i) % nSettings;
+        auto const data = detp.SharedDataFor(settings[iSetting]);
+        if (data.use_count() == 0) ++errors; // the result must share ownership
+        if (!sameConversions(*data, expected[iSetting])) ++errors;
+        unsigned int const samples = data->NumberTimeSamples();
+        if ((samples != samplesA) && (samples != samplesB)) ++errors;
+      }
+      nErrors += errors;
+      --nRunning;
+    });
+  }
+
+  // the writer changes the number of samples until all readers are done
+  unsigned int nChanges = 0U;
+  while (nRunning > 0U) {
+    detp.SetNumberTimeSamples((nChanges++ % 2U) ? samplesA : samplesB);
+    std::this_thread::yield();
+  }
+
+  for (auto& reader : readers)
+    reader.join();
+
+  // after the last change, new data have the new number of samples
+  detp.SetNumberTimeSamples(samplesA);
+  if (detp.DataFor(settings.front()).NumberTimeSamples() != samplesA) ++nErrors;
+  if (!sameConversions(detp.DataFor(settings.front()), expected.front())) ++nErrors;
+
+  mf::LogVerbatim("detp_concurrency_test")
+    << nThreads << " threads performed " << nRequests << " requests each, with " << nChanges
+    << " changes of the number of time samples";
+
+  if (nErrors > 0) { mf::LogError("detp_concurrency_test") << nErrors << " errors detected!"; }
+
+  return nErrors;
+} // main()
@@ -0,0 +1,178 @@
+/**
+ * @file   DetectorPropertiesData_test.cc
+ * @brief  Test of the corrections of `detinfo::DetectorPropertiesData`.
+ * @see    `lardataalg/DetectorInfo/DetectorPropertiesData.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DetectorPropertiesData_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::exp()
+#include <stdexcept> // std::runtime_error
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// minimal provider with constant values
+class MockDetectorProperties: public detinfo::DetectorProperties {
+public:
+  double Efield(unsigned int = 0) const override { return 0.5; }
+  double DriftVelocity(double = 0., double = 0.) const override { return 0.16; }
+  double BirksCorrection(double dQdX) const override { return dQdX; }
+  double BirksCorrection(double dQdX, double) const override { return dQdX; }
+  double ModBoxCorrection(double dQdX) const override { return dQdX; }
+  double ModBoxCorrection(double dQdX, double) const override { return dQdX; }
+  double ElectronLifetime() const override { return 3000.0; }
+  double Density(double) const override { return 1.39; }
+  double Temperature() const override { return 87.0; }
+  double Eloss(double, double, double) const override { return 2.1; }
+  double ElossVar(double, double) const override { return 0.1; }
+  double ElectronsToADC() const override { return 6.8906513e-3; }
+  unsigned int NumberTimeSamples() const override { return 4492; }
+  unsigned int ReadOutWindowSize() const override { return 4492; }
+  double TimeOffsetU() const override { return 0.0; }
+  double TimeOffsetV() const override { return 0.0; }
+  double TimeOffsetZ() const override { return 0.0; }
+  bool SimpleBoundary() const override { return true; }
+  detinfo::DetectorPropertiesData DataFor(detinfo::DetectorClocksData const&) const override
+    { return makeData(); }
+
+  // two cryostats: the first with two 3-plane TPCs, the second with a 2-plane one
+  detinfo::DetectorPropertiesData makeData() const {
+    std::vector<std::vector<std::vector<double>>> const offsets{
+      { { 10.0, 11.0, 12.0 }, { 20.0, 21.0, 22.0 } },
+      { { 30.0, 31.0 } }
+      };
+    std::vector<std::vector<double>> const directions{ { +1.0, -1.0 }, { +1.0 } };
+    return detinfo::DetectorPropertiesData{
+      *this, 0.08, detinfo::XTicksTable{ 0.08, offsets, directions }
+      };
+  }
+}; // MockDetectorProperties
+
+
+//------------------------------------------------------------------------------
+detinfo::DetectorClocksData makeClocks(double const triggerOffsetTPC) {
+  return {
+    -1100.0, triggerOffsetTPC, 1.25, 1.5,
+    detinfo::ElecClock{ 10.0, 1600.0, 2.0 },
+    detinfo::ElecClock{ 11.0, 1600.0, 64.0 },
+    detinfo::ElecClock{ 12.0, 1600.0, 16.0 },
+    detinfo::ElecClock{ 13.0, 1600.0, 31.25 }
+    };
+} // makeClocks()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( LifetimeCorrectionTestCase ) {
+
+  auto const tol = boost::test_tools::tolerance(1e-12);
+
+  MockDetectorProperties const detp;
+  detinfo::DetectorPropertiesData const detProp = detp.makeData();
+  double const tau = detp.ElectronLifetime(); // us
+
+  std::vector<double> const ticks{ -20.0, 0.0, 15.5, 1234.5, 3200.0, 4095.0 };
+  std::vector<double> const charges{ 1.0, 2.5, 100.0, 0.5, 3.0, 7.0 };
+
+  for (double const triggerOffsetTPC: { -1600.0, -400.0 }) {
+    detinfo::DetectorClocksData const clockData = makeClocks(triggerOffsetTPC);
+    double const period = sampling_rate(clockData) * 1.e-3; // us
+    double const offset = trigger_offset(clockData); // ticks
+
+    for (double const T0: { 0.0, 250.0, -1500.0 }) { // ns
+      std::vector<double> expected;
+      for (double const tick: ticks)
+        expected.push_back(std::exp(((tick - offset) * period - T0 * 1.e-3) / tau));
+
+      for (std::size_t i = 0; i < ticks.size(); ++i)
+        BOOST_TEST(detProp.LifetimeCorrection(ticks[i], clockData, T0) == expected[i], tol);
+
+      std::vector<double> corrected(ticks.size());
+      detProp.LifetimeCorrection
+        (ticks.data(), charges.data(), ticks.size(), corrected.data(), clockData, T0);
+      for (std::size_t i = 0; i < ticks.size(); ++i)
+        BOOST_TEST(corrected[i] == charges[i] * expected[i], tol);
+
+      // in place
+      corrected = charges;
+      detProp.LifetimeCorrection
+        (ticks.data(), corrected.data(), ticks.size(), corrected.data(), clockData, T0);
+      for (std::size_t i = 0; i < ticks.size(); ++i)
+        BOOST_TEST(corrected[i] == charges[i] * expected[i], tol);
+    } // for T0
+  } // for trigger offsets
+
+} // BOOST_AUTO_TEST_CASE( LifetimeCorrectionTestCase )
+
+
+//------------------------------------------------------------------------------
+// provider also implementing the time offset of view Y, counting its calls
+class MockDetectorPropertiesWithY: public MockDetectorProperties {
+public:
+  mutable unsigned int nTimeOffsetYCalls = 0U;
+  double TimeOffsetY() const override { ++nTimeOffsetYCalls; return 1.5; }
+}; // MockDetectorPropertiesWithY
+
+
+BOOST_AUTO_TEST_CASE( TimeOffsetYTestCase ) {
+
+  // the offset is copied when the data is created, like the other offsets
+  MockDetectorPropertiesWithY const detpY;
+  detinfo::DetectorPropertiesData const detPropY = detpY.makeData();
+  [[maybe_unused]] unsigned int const nCalls = detpY.nTimeOffsetYCalls;
+  BOOST_TEST(detPropY.TimeOffsetY() == 1.5);
+#ifdef NDEBUG
+  // debug builds query the provider again to check the copy
+  BOOST_TEST(detpY.nTimeOffsetYCalls == nCalls);
+#endif // NDEBUG
+
+  // a provider not implementing it still reports the error
+  MockDetectorProperties const detp;
+  detinfo::DetectorPropertiesData const detProp = detp.makeData();
+  BOOST_CHECK_THROW(detProp.TimeOffsetY(), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE( TimeOffsetYTestCase )
+
+
+//------------------------------------------------------------------------------
+// provider not implementing the time offset of view Y, counting its calls
+class MockDetectorPropertiesWithoutY: public MockDetectorProperties {
+public:
+  mutable unsigned int nTimeOffsetYCalls = 0U;
+  double TimeOffsetY() const override
+    { ++nTimeOffsetYCalls; throw std::runtime_error("TimeOffsetY not implemented"); }
+}; // MockDetectorPropertiesWithoutY
+
+
+BOOST_AUTO_TEST_CASE( SnapshotCheckTestCase ) {
+
+  // the checks of the copied values (debug builds) query only the value
+  // being accessed, and never an offset of view Y the provider does not have
+  MockDetectorPropertiesWithoutY const detp;
+  detinfo::DetectorPropertiesData const detProp = detp.makeData();
+  unsigned int const nCalls = detp.nTimeOffsetYCalls;
+
+  BOOST_TEST(detProp.Efield() == 0.5);
+  BOOST_TEST(detProp.Temperature() == 87.0);
+  BOOST_TEST(detProp.Density() == 1.39);
+  BOOST_TEST(detProp.ElectronLifetime() == 3000.0);
+  BOOST_TEST(detProp.ReadOutWindowSize() == 4492U);
+  BOOST_TEST(detProp.TimeOffsetU() == 0.0);
+  BOOST_TEST(detProp.SimpleBoundary());
+  BOOST_TEST(detProp.SnapshotIsCurrent());
+  BOOST_TEST(detp.nTimeOffsetYCalls == nCalls);
+
+  MockDetectorPropertiesWithY const detpY;
+  BOOST_TEST(detpY.makeData().SnapshotIsCurrent());
+
+} // BOOST_AUTO_TEST_CASE( SnapshotCheckTestCase )
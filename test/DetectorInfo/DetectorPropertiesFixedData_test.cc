@@ -0,0 +1,137 @@
+/**
+ * @file   DetectorPropertiesFixedData_test.cc
+ * @brief  Test of `detinfo::DetectorPropertiesFixedData`.
+ * @see    `lardataalg/DetectorInfo/DetectorPropertiesFixedData.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DetectorPropertiesFixedData_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesFixedData.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::length_error
+#include <utility>   // std::pair
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// minimal provider with constant values
+class MockDetectorProperties: public detinfo::DetectorProperties {
+public:
+  double Efield(unsigned int = 0) const override { return 0.5; }
+  double DriftVelocity(double = 0., double = 0.) const override { return 0.16; }
+  double BirksCorrection(double dQdX) const override { return dQdX; }
+  double BirksCorrection(double dQdX, double) const override { return dQdX; }
+  double ModBoxCorrection(double dQdX) const override { return dQdX; }
+  double ModBoxCorrection(double dQdX, double) const override { return dQdX; }
+  double ElectronLifetime() const override { return 3000.0; }
+  double Density(double) const override { return 1.39; }
+  double Temperature() const override { return 87.0; }
+  double Eloss(double, double, double) const override { return 2.1; }
+  double ElossVar(double, double) const override { return 0.1; }
+  double ElectronsToADC() const override { return 6.8906513e-3; }
+  unsigned int NumberTimeSamples() const override { return 4492; }
+  unsigned int ReadOutWindowSize() const override { return 4492; }
+  double TimeOffsetU() const override { return 0.0; }
+  double TimeOffsetV() const override { return 0.0; }
+  double TimeOffsetZ() const override { return 0.0; }
+  bool SimpleBoundary() const override { return true; }
+
+  // two cryostats: the first with two 3-plane TPCs, the second with a 2-plane one
+  detinfo::DetectorPropertiesData DataFor(detinfo::DetectorClocksData const&) const override {
+    std::vector<std::vector<std::vector<double>>> const offsets{
+      { { 10.0, 11.0, 12.0 }, { 20.0, 21.0, 22.0 } },
+      { { 30.0, 31.0 } }
+      };
+    std::vector<std::vector<double>> const directions{ { +1.0, -1.0 }, { +1.0 } };
+    return detinfo::DetectorPropertiesData{
+      *this, 0.08, detinfo::XTicksTable{ 0.08, offsets, directions }
+      };
+  }
+}; // MockDetectorProperties
+
+
+detinfo::DetectorClocksData makeClocks() {
+  return {
+    -1100.0, -1600.0, 1.25, 1.5,
+    detinfo::ElecClock{ 10.0, 1600.0, 2.0 },
+    detinfo::ElecClock{ 11.0, 1600.0, 64.0 },
+    detinfo::ElecClock{ 12.0, 1600.0, 16.0 },
+    detinfo::ElecClock{ 13.0, 1600.0, 31.25 }
+    };
+} // makeClocks()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ConversionTestCase ) {
+
+  MockDetectorProperties const detp;
+  detinfo::DetectorPropertiesData const data = detp.DataFor(makeClocks());
+  detinfo::DetectorPropertiesFixedData<3U, 2U, 2U> const fixed{ data };
+
+  BOOST_TEST(fixed.Data().ElectronLifetime() == data.ElectronLifetime());
+  BOOST_TEST(fixed.Data().GetXTicksCoefficient() == data.GetXTicksCoefficient());
+
+  detinfo::XTicksTable const& table = data.XTicks();
+  std::vector<double> const ticks{ -20.0, 0.0, 15.5, 1234.5, 4095.0 };
+  std::vector<double> x(ticks.size()), expectedX(ticks.size());
+  std::vector<double> backTicks(ticks.size()), expectedTicks(ticks.size());
+  std::vector<std::pair<double, geo::PlaneID>> hits;
+  for (unsigned int c = 0; c < table.NCryostats(); ++c) {
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t) {
+      for (unsigned int p = 0; p < table.NPlanes(t, c); ++p) {
+        geo::PlaneID const planeid{ c, t, p };
+
+        for (double const tick: ticks) {
+          double const X = data.ConvertTicksToX(tick, p, t, c);
+          BOOST_TEST(fixed.ConvertTicksToX(tick, p, t, c) == X);
+          BOOST_TEST(fixed.ConvertTicksToX(tick, planeid) == X);
+          BOOST_TEST(fixed.ConvertXToTicks(X, p, t, c) == data.ConvertXToTicks(X, p, t, c));
+          BOOST_TEST(fixed.ConvertXToTicks(X, planeid) == data.ConvertXToTicks(X, planeid));
+          hits.emplace_back(tick, planeid);
+        }
+
+        fixed.ConvertTicksToX(ticks.data(), ticks.size(), x.data(), planeid);
+        data.ConvertTicksToX(ticks.data(), ticks.size(), expectedX.data(), planeid);
+        fixed.ConvertXToTicks(x.data(), x.size(), backTicks.data(), planeid);
+        data.ConvertXToTicks(x.data(), x.size(), expectedTicks.data(), planeid);
+        for (std::size_t i = 0; i < ticks.size(); ++i) {
+          BOOST_TEST(x[i] == expectedX[i]);
+          BOOST_TEST(backTicks[i] == expectedTicks[i]);
+        }
+      } // for planes
+    } // for TPCs
+  } // for cryostats
+
+  std::vector<double> hitX(hits.size()), expectedHitX(hits.size());
+  fixed.ConvertTicksToX(hits.data(), hits.size(), hitX.data());
+  data.ConvertTicksToX(hits.data(), hits.size(), expectedHitX.data());
+  for (std::size_t i = 0; i < hits.size(); ++i)
+    BOOST_TEST(hitX[i] == expectedHitX[i]);
+
+} // BOOST_AUTO_TEST_CASE( ConversionTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( LayoutTestCase ) {
+
+  MockDetectorProperties const detp;
+  detinfo::DetectorPropertiesData const data = detp.DataFor(makeClocks());
+
+  // larger capacity than needed is fine
+  BOOST_CHECK_NO_THROW((detinfo::DetectorPropertiesFixedData<4U, 3U, 2U>{ data }));
+
+  BOOST_CHECK_THROW((detinfo::DetectorPropertiesFixedData<2U, 2U, 2U>{ data }), std::length_error);
+  BOOST_CHECK_THROW((detinfo::DetectorPropertiesFixedData<3U, 1U, 2U>{ data }), std::length_error);
+  BOOST_CHECK_THROW((detinfo::DetectorPropertiesFixedData<3U, 2U>{ data }), std::length_error);
+
+} // BOOST_AUTO_TEST_CASE( LayoutTestCase )
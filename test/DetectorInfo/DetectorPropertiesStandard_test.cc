@@ -12,12 +12,16 @@
 #include "lardataalg/DetectorInfo/DetectorClocksStandardTestHelpers.h"
 #include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
 #include "lardataalg/DetectorInfo/DetectorPropertiesStandardTestHelpers.h"
+#include "lardataalg/DetectorInfo/DriftVelocityMap.h"
+#include "lardataalg/DetectorInfo/GridMap3D.h"
 #include "lardataalg/DetectorInfo/LArPropertiesStandardTestHelpers.h"
 #include "test/Geometry/geometry_unit_test_base.h"
 
 // C/C++ standard libraries
 #include <array>
+#include <cmath> // std::abs(), std::exp(), std::log()
 #include <iomanip>
+#include <vector>
 
 //------------------------------------------------------------------------------
 //---  The test environment
@@ -96,7 +100,7 @@ main(int argc, char const** argv)
   // environment. So we invoke a simple set up for each of the dependencies:
   TestEnv.SimpleProviderSetup<detinfo::LArPropertiesStandard>();
   TestEnv.SimpleProviderSetup<detinfo::DetectorClocksStandard>();
-  TestEnv.SimpleProviderSetup<detinfo::DetectorPropertiesStandard>();
+  auto const& detpStandard = *TestEnv.SimpleProviderSetup<detinfo::DetectorPropertiesStandard>();
 
   //
   // run the test algorithm
@@ -131,6 +135,228 @@ main(int argc, char const** argv)
                                << "\nTPC waveform length: " << nWaveformTicks << " ticks ("
                                << (nWaveformTicks * TDCtick / 1000) << " us)";
 
+  // the drift velocities remembered at configuration match the parameterization
+  // (all the test configurations have a field for each of three plane gaps)
+  for (unsigned int planegap = 0; planegap < 3U; ++planegap) {
+    double const efield = detpStandard.Efield(planegap);
+    double const expected = detpStandard.ComputeDriftVelocity(efield, detp.Temperature());
+    if (detpStandard.DriftVelocity(efield, detp.Temperature()) != expected) {
+      mf::LogError("detp_test") << "Drift velocity at " << efield << " kV/cm is "
+                                << detpStandard.DriftVelocity(efield, detp.Temperature())
+                                << " cm/us, computed " << expected << " cm/us";
+      ++nErrors;
+    }
+  } // for
+  if (driftVelocity != detpStandard.ComputeDriftVelocity(detp.Efield(), detp.Temperature())) {
+    mf::LogError("detp_test") << "Drift velocity with default arguments is not the computed one";
+    ++nErrors;
+  }
+
+  // the drift velocity map matches the parameterization at the nodes of the
+  // field map, and interpolates the velocity between them
+  {
+    // field varying along all the axes, with no field at one node
+    detinfo::GridMap3D::Size_t const nNodes{3U, 2U, 2U};
+    detinfo::GridMap3D::Vector_t const origin{-10.0, 0.0, 5.0};
+    detinfo::GridMap3D::Vector_t const spacing{5.0, 10.0, 20.0};
+    std::vector<double> efield;
+    for (unsigned int k = 0; k < nNodes[2]; ++k)
+      for (unsigned int j = 0; j < nNodes[1]; ++j)
+        for (unsigned int i = 0; i < nNodes[0]; ++i)
+          efield.push_back(0.2 + 0.15 * i + 0.05 * j + 0.1 * k);
+    efield.back() = 0.0;
+    auto const nodeIndex = [&nNodes](unsigned int i, unsigned int j, unsigned int k) {
+      return i + nNodes[0] * (j + nNodes[1] * k);
+    };
+    auto const nodePosition = [&origin, &spacing](unsigned int i, unsigned int j, unsigned int k) {
+      return std::array<double, 3U>{
+        origin[0] + i * spacing[0], origin[1] + j * spacing[1], origin[2] + k * spacing[2]};
+    };
+
+    lar::util::RealComparisons<double> const vdCheck(1e-12); // cm/us
+    for (double const temperature : {0.0, 88.0}) {
+      double const T = (temperature == 0.0) ? detp.Temperature() : temperature;
+      detinfo::DriftVelocityMap const vdMap{
+        detpStandard, detinfo::GridMap3D{nNodes, origin, spacing, efield}, temperature};
+
+      std::vector<double> nodeVd(efield.size());
+      for (std::size_t iNode = 0; iNode < efield.size(); ++iNode)
+        nodeVd[iNode] =
+          (efield[iNode] > 0.0) ? detpStandard.ComputeDriftVelocity(efield[iNode], T) : 0.0;
+
+      std::vector<std::array<double, 3U>> points;
+      std::vector<double> expected;
+
+      // nodes
+      for (unsigned int k = 0; k < nNodes[2]; ++k)
+        for (unsigned int j = 0; j < nNodes[1]; ++j)
+          for (unsigned int i = 0; i < nNodes[0]; ++i) {
+            points.push_back(nodePosition(i, j, k));
+            expected.push_back(nodeVd[nodeIndex(i, j, k)]);
+          }
+
+      // centres of the cells: the average of the velocities at their corners
+      for (unsigned int i = 0; i + 1 < nNodes[0]; ++i) {
+        double average = 0.0;
+        for (unsigned int corner = 0; corner < 8U; ++corner)
+          average += nodeVd[nodeIndex(i + (corner & 1U), (corner >> 1) & 1U, corner >> 2)];
+        auto center = nodePosition(i, 0U, 0U);
+        for (std::size_t axis = 0; axis < 3U; ++axis)
+          center[axis] += spacing[axis] / 2.0;
+        points.push_back(center);
+        expected.push_back(average / 8.0);
+      }
+
+      // outside the grid: the value on the closest point of the border
+      points.push_back({origin[0] - 100.0, origin[1] - 100.0, origin[2] - 100.0});
+      expected.push_back(nodeVd[nodeIndex(0U, 0U, 0U)]);
+      auto beyond = nodePosition(nNodes[0] - 1U, 0U, 1U);
+      beyond[0] += 50.0;
+      points.push_back(beyond);
+      expected.push_back(nodeVd[nodeIndex(nNodes[0] - 1U, 0U, 1U)]);
+      auto midBeyond = nodePosition(0U, 0U, 0U);
+      midBeyond[1] -= 30.0;
+      midBeyond[2] += spacing[2] / 2.0;
+      points.push_back(midBeyond);
+      expected.push_back((nodeVd[nodeIndex(0U, 0U, 0U)] + nodeVd[nodeIndex(0U, 0U, 1U)]) / 2.0);
+
+      std::vector<double> xs, ys, zs;
+      for (auto const& point : points) {
+        xs.push_back(point[0]);
+        ys.push_back(point[1]);
+        zs.push_back(point[2]);
+      }
+      std::vector<double> vds(points.size());
+      vdMap.DriftVelocity(xs.data(), ys.data(), zs.data(), points.size(), vds.data());
+
+      for (std::size_t iPoint = 0; iPoint < points.size(); ++iPoint) {
+        double const vd = vdMap.DriftVelocity(xs[iPoint], ys[iPoint], zs[iPoint]);
+        if (vdCheck.equal(vd, expected[iPoint]) && vdCheck.equal(vds[iPoint], expected[iPoint]))
+          continue;
+        mf::LogError("detp_test") << "Drift velocity map at (" << xs[iPoint] << ", " << ys[iPoint]
+                                  << ", " << zs[iPoint] << ") cm and " << T << " K is " << vd
+                                  << " cm/us (" << vds[iPoint] << " in batch), expected "
+                                  << expected[iPoint] << " cm/us";
+        ++nErrors;
+      } // for points
+    }   // for temperatures
+  }
+
+  // the batch energy loss fluctuations are exactly the ones of the formula
+  {
+    constexpr double K = 0.307075;     // 4 pi N_A r_e^2 m_e c^2 (MeV cm^2/mol).
+    constexpr double me = 0.510998918; // Electron mass (MeV/c^2).
+    auto const& larp = *TestEnv.Provider<detinfo::LArProperties>();
+    std::vector<double> const moms{0.01, 0.1, 0.2, 0.5, 1.0, 3.0, 10.0, 1000.0}; // GeV/c
+    for (double const mass : {0.105658, 0.938272}) {                             // GeV/c^2
+      std::vector<double> vars(moms.size());
+      detp.ElossVar(moms.data(), moms.size(), vars.data(), mass);
+      for (std::size_t i = 0; i < moms.size(); ++i) {
+        double const bg = moms[i] / mass;
+        double const gamma2 = 1. + bg * bg;
+        double const beta2 = bg * bg / gamma2;
+        double const expected = gamma2 * (1. - 0.5 * beta2) * me *
+                                (larp.AtomicNumber() / larp.AtomicMass()) * K * detp.Density();
+        if ((vars[i] == expected) && (detp.ElossVar(moms[i], mass) == expected)) continue;
+        mf::LogError("detp_test") << "Energy loss variance at " << moms[i] << " GeV/c is "
+                                  << vars[i] << " (batch), " << detp.ElossVar(moms[i], mass)
+                                  << " (single), expected " << expected;
+        ++nErrors;
+      } // for momenta
+    }   // for masses
+  }
+
+  // providers with modified configurations
+  fhicl::ParameterSet pset = TestEnv.ServiceParameters("DetectorPropertiesService");
+  auto makeDetProp = [&TestEnv, &geom, &pset](std::vector<double> const& efield) {
+    pset.put_or_replace("Efield", efield);
+    return detinfo::DetectorPropertiesStandard{
+      pset, &geom, TestEnv.Provider<detinfo::LArProperties>(), {"InheritNumberTimeSamples"}};
+  };
+  std::vector<double> const configuredEfield = pset.get<std::vector<double>>("Efield");
+
+  // the x/ticks offsets take the field of the plane gaps from the configuration:
+  // it must cover at least three gaps, and the gaps beyond the planes are ignored
+  if (pset.get<bool>("IncludeInterPlanePitchInXTickOffsets", true)) {
+    std::vector<double> efield = configuredEfield;
+
+    efield.resize(3U);
+    auto const threeGapData = makeDetProp(efield).DataFor(clock_data);
+    efield.push_back(efield.back());
+    auto const fourGapData = makeDetProp(efield).DataFor(clock_data);
+    for (auto const& planeID : geom.IteratePlaneIDs()) {
+      if (fourGapData.GetXTicksOffset(planeID) == threeGapData.GetXTicksOffset(planeID)) continue;
+      mf::LogError("detp_test") << "X/ticks offset of " << std::string(planeID) << " is "
+                                << fourGapData.GetXTicksOffset(planeID) << " with four gaps, "
+                                << threeGapData.GetXTicksOffset(planeID) << " with three";
+      ++nErrors;
+    } // for
+
+    efield.resize(2U);
+    try {
+      makeDetProp(efield);
+      mf::LogError("detp_test") << "Configuration with only two plane gaps was accepted";
+      ++nErrors;
+    }
+    catch (cet::exception const&) {
+    }
+  }
+
+  // the tabulated energy loss follows the formula also across its kinks
+  {
+    double const tolerance = 1e-4;
+    std::vector<double> const masses{0.105658, 0.938272}; // GeV/c^2
+    std::vector<double> const tcuts{0., 1.};              // MeV
+    pset.put_or_replace("ElossTableMasses", masses);
+    pset.put_or_replace("ElossTableTcuts", tcuts);
+    pset.put_or_replace("ElossTableTolerance", tolerance);
+    auto const tabulated = makeDetProp(configuredEfield);
+    for (double const mass : masses) {
+      for (double const tcut : tcuts) {
+        // scan with a step unrelated to the node spacing
+        unsigned int const NPoints = 200'003U;
+        double const minLog = std::log(0.05);
+        double const step = (std::log(1e5) - minLog) / NPoints;
+        double maxRelError = 0.0;
+        for (unsigned int i = 0; i <= NPoints; ++i) {
+          double const mom = mass * std::exp(minLog + i * step);
+          double const relError = std::abs(tabulated.Eloss(mom, mass, tcut) /
+                                             tabulated.ElossAnalytic(mom, mass, tcut) -
+                                           1.0);
+          if (relError > maxRelError) maxRelError = relError;
+        } // for
+        if (maxRelError <= tolerance) continue;
+        mf::LogError("detp_test") << "Tabulated energy loss for mass " << mass
+                                  << " GeV/c^2 and tcut " << tcut
+                                  << " MeV has relative error up to " << maxRelError;
+        ++nErrors;
+      } // for cuts
+    }   // for masses
+    pset.put_or_replace("ElossTableMasses", std::vector<double>{});
+  }
+
+  // configured values out of the range of the drift velocity parameterization
+  // are reported once at configuration, while explicit arguments are counted
+  // at each call
+  {
+    std::vector<double> efield = configuredEfield;
+    efield[0] = 5.0;                          // kV/cm
+    pset.put_or_replace("Temperature", 95.0); // K
+    pset.put_or_replace("MaxDriftVelocityRangeWarnings", 2U);
+    auto const outOfRange = makeDetProp(efield);
+    outOfRange.DriftVelocity();
+    for (int i = 0; i < 5; ++i)
+      outOfRange.DriftVelocity(6.0, 88.0);
+    outOfRange.DriftVelocity(0.5, 100.0);
+    if ((outOfRange.NEfieldOutOfRange() != 5U) || (outOfRange.NTemperatureOutOfRange() != 1U)) {
+      mf::LogError("detp_test") << "Drift velocity requests out of range: "
+                                << outOfRange.NEfieldOutOfRange() << " for the field (expected 5), "
+                                << outOfRange.NTemperatureOutOfRange()
+                                << " for the temperature (expected 1)";
+      ++nErrors;
+    }
+  }
+
   // accumulate the plane IDs; needed just for table formatting
   unsigned int headerColWidth = 0U;
   for (auto planeID : geom.IteratePlaneIDs()) {
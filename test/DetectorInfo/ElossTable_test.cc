@@ -0,0 +1,97 @@
+/**
+ * @file   ElossTable_test.cc
+ * @brief  Test of `detinfo::ElossTable`.
+ * @see    `lardataalg/DetectorInfo/ElossTable.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ElossTable_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/ElossTable.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::log(), std::exp()
+#include <stdexcept> // std::runtime_error
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// a function with the shape of the Bethe-Bloch one: 1/beta^2 (log + const)
+double betheLike(double const bg) {
+  double const beta2 = bg * bg / (1.0 + bg * bg);
+  return (std::log(bg) + 10.0) / beta2;
+}
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ElossTableAccuracyTestCase ) {
+
+  double const tolerance = 1e-4;
+  detinfo::ElossTable const table{ betheLike, 0.05, 1e5, tolerance };
+
+  BOOST_TEST(table.MaxRelativeError() <= tolerance);
+  BOOST_TEST(table.NNodes() > 16U);
+
+  BOOST_TEST( table.Covers(0.05));
+  BOOST_TEST( table.Covers(1e5));
+  BOOST_TEST(!table.Covers(0.049));
+  BOOST_TEST(!table.Covers(1.1e5));
+
+  // nodes are exact, and so are the range ends
+  BOOST_TEST(table(0.05) == betheLike(0.05), boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(table(1e5) == betheLike(1e5), boost::test_tools::tolerance(1e-12));
+
+  // scan with a step unrelated to the node spacing
+  unsigned int const NPoints = 100'003U;
+  double const step = (std::log(1e5) - std::log(0.05)) / NPoints;
+  double maxRelError = 0.0;
+  for (unsigned int i = 0; i <= NPoints; ++i) {
+    double const bg = std::exp(std::log(0.05) + i * step);
+    if (!table.Covers(bg)) continue; // rounding at the edges
+    double const relError = std::abs(table(bg) / betheLike(bg) - 1.0);
+    if (relError > maxRelError) maxRelError = relError;
+  }
+  BOOST_TEST(maxRelError <= tolerance);
+
+} // BOOST_AUTO_TEST_CASE( ElossTableAccuracyTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ElossTableFailureTestCase ) {
+
+  // a kink can't be interpolated linearly within 1e-12 with few nodes
+  auto const kink = [](double const bg) { return (bg < 1.0) ? 1.0 : bg; };
+  BOOST_CHECK_THROW(detinfo::ElossTable(kink, 0.1, 10.0, 1e-12, 1000U), std::runtime_error);
+
+  BOOST_CHECK_THROW(detinfo::ElossTable(betheLike, 1.0, 0.5, 1e-4), std::invalid_argument);
+
+} // BOOST_AUTO_TEST_CASE( ElossTableFailureTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ElossTableBreakpointTestCase ) {
+
+  // linear in log(beta gamma) on each side of a kink at beta gamma = 1:
+  // with a breakpoint there, the interpolation is exact with the first grid
+  auto const kink = [](double const bg) { return (bg < 1.0) ? 1.0 : 1.0 + std::log(bg); };
+  BOOST_CHECK_THROW(detinfo::ElossTable(kink, 0.1, 20.0, 1e-12, 1000U), std::runtime_error);
+
+  // breakpoints out of the range are ignored
+  std::vector<double> const breakpoints{ 100.0, 1.0, 0.01, 0.1 };
+  detinfo::ElossTable const table{ kink, 0.1, 20.0, breakpoints, 1e-12, 1000U };
+  BOOST_TEST(table.NSegments() == 2U);
+  BOOST_TEST(table.NNodes() == 24U + 30U); // 10 nodes per unit of log(beta gamma)
+  BOOST_TEST(table.MaxRelativeError() <= 1e-12);
+  BOOST_TEST(table(1.0) == 1.0, boost::test_tools::tolerance(1e-12));
+
+  unsigned int const NPoints = 10'007U;
+  double const step = (std::log(20.0) - std::log(0.1)) / NPoints;
+  for (unsigned int i = 0; i <= NPoints; ++i) {
+    double const bg = std::exp(std::log(0.1) + i * step);
+    if (!table.Covers(bg)) continue; // rounding at the edges
+    BOOST_TEST(table(bg) == kink(bg), boost::test_tools::tolerance(1e-12));
+  }
+
+} // BOOST_AUTO_TEST_CASE( ElossTableBreakpointTestCase )
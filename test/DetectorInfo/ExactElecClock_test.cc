@@ -0,0 +1,106 @@
+/**
+ * @file   ExactElecClock_test.cc
+ * @brief  Test of `detinfo::ExactElecClock`.
+ * @see    `lardataalg/DetectorInfo/ExactElecClock.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ExactElecClock_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksException.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+#include "lardataalg/DetectorInfo/ExactElecClock.h"
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( TickArithmeticTestCase ) {
+
+  // 31.25 MHz, 1.6 ms frames
+  detinfo::ExactElecClock const clock{ 0, 50000, 250, 8 };
+
+  BOOST_TEST(clock.FrequencyNumerator() == 125);
+  BOOST_TEST(clock.FrequencyDenominator() == 4);
+  BOOST_TEST(clock.Frequency() == 31.25);
+  BOOST_TEST(clock.TickPeriod() == 0.032);
+  BOOST_TEST(clock.FramePeriod() == 1600.0);
+
+  detinfo::ExactElecClock const advanced = clock.AdvanceTicksBy(123456);
+  BOOST_TEST(advanced.Ticks() == 123456);
+  BOOST_TEST(advanced.Frame() == 2);
+  BOOST_TEST(advanced.Sample() == 23456);
+  BOOST_TEST(advanced.Time() == 3950.592);
+  BOOST_TEST(advanced.Ticks(advanced.Sample(), advanced.Frame()) == 123456);
+
+  // negative ticks belong to negative frames, with non-negative samples
+  detinfo::ExactElecClock const before = clock.AdvanceTicksBy(-1);
+  BOOST_TEST(before.Frame() == -1);
+  BOOST_TEST(before.Sample() == 49999);
+  BOOST_TEST(before.Ticks() == -1);
+  BOOST_TEST(clock.Frame(-50000) == -1);
+  BOOST_TEST(clock.Sample(-50000) == 0);
+  BOOST_TEST(clock.Frame(-50001) == -2);
+
+  // many small steps do not drift
+  detinfo::ExactElecClock stepped = clock;
+  for (int i = 0; i < 1000000; ++i) stepped = stepped.AdvanceTicksBy(7);
+  BOOST_TEST(stepped.Ticks() == 7000000);
+  BOOST_TEST(stepped.Frame() == 140);
+  BOOST_TEST(stepped.Sample() == 0);
+  BOOST_TEST((stepped == clock.WithTick(0, 140)));
+
+  // very large tick numbers stay exact
+  detinfo::ExactElecClock::tick_t const bigTick = (detinfo::ExactElecClock::tick_t{1} << 40) + 3;
+  detinfo::ExactElecClock const far = clock.WithTick(bigTick);
+  BOOST_TEST(far.Ticks() == bigTick);
+  BOOST_TEST(far.Frame() * 50000 + far.Sample() == bigTick);
+
+} // BOOST_AUTO_TEST_CASE( TickArithmeticTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( TimeConversionTestCase ) {
+
+  detinfo::ExactElecClock const clock{ 0, 3200, 2 }; // TPC clock: 2 MHz
+
+  BOOST_TEST(clock.TickAt(1613.7) == 3227);
+  BOOST_TEST(clock.SampleAt(1613.7) == 27);
+  BOOST_TEST(clock.FrameAt(1613.7) == 1);
+  BOOST_TEST(clock.TickAt(-0.25) == -1);
+  BOOST_TEST(clock.WithTime(1613.7).Time() == 1613.5);
+  BOOST_TEST(clock.Time(20, 1) == 1610.0);
+
+  BOOST_CHECK_THROW((detinfo::ExactElecClock{ 0, 0, 2 }), detinfo::DetectorClocksException);
+  BOOST_CHECK_THROW((detinfo::ExactElecClock{ 0, 3200, 0 }), detinfo::DetectorClocksException);
+
+} // BOOST_AUTO_TEST_CASE( TimeConversionTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ElecClockConversionTestCase ) {
+
+  for (double const frequency: { 2.0, 16.0, 31.25, 64.0, 62.5 }) {
+    detinfo::ElecClock const clock{ 1613.7, 1600.0, frequency };
+    detinfo::ExactElecClock const exact = detinfo::ExactElecClock::FromElecClock(clock);
+
+    BOOST_TEST(exact.Frequency() == frequency);
+    BOOST_TEST(exact.FramePeriod() == clock.FramePeriod());
+    BOOST_TEST(exact.FrameTicks() == clock.FrameTicks());
+    BOOST_TEST(exact.Ticks() == clock.Ticks());
+    BOOST_TEST(exact.Frame() == clock.Frame());
+    BOOST_TEST(exact.Sample() == clock.Sample());
+
+    detinfo::ElecClock const back = exact.ToElecClock();
+    BOOST_TEST(back.Frequency() == clock.Frequency());
+    BOOST_TEST(back.FramePeriod() == clock.FramePeriod());
+    BOOST_TEST(back.Ticks() == clock.Ticks());
+    BOOST_TEST(back.Time() == clock.Time(clock.Time()), boost::test_tools::tolerance(1e-12));
+  } // for frequencies
+
+  // frame not made of whole ticks
+  BOOST_CHECK_THROW(
+    detinfo::ExactElecClock::FromElecClock(detinfo::ElecClock{ 0.0, 1600.1, 2.0 }),
+    detinfo::DetectorClocksException);
+
+} // BOOST_AUTO_TEST_CASE( ElecClockConversionTestCase )
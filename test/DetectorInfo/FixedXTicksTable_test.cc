@@ -0,0 +1,77 @@
+/**
+ * @file   FixedXTicksTable_test.cc
+ * @brief  Test of `detinfo::FixedXTicksTable`.
+ * @see    `lardataalg/DetectorInfo/FixedXTicksTable.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( FixedXTicksTable_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/FixedXTicksTable.h"
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::length_error
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// two cryostats: the first with two 3-plane TPCs, the second with a 2-plane one
+detinfo::XTicksTable makeTable() {
+  std::vector<std::vector<std::vector<double>>> const offsets{
+    { { 10.0, 11.0, 12.0 }, { 20.0, 21.0, 22.0 } },
+    { { 30.0, 31.0 } }
+    };
+  std::vector<std::vector<double>> const directions{ { +1.0, -1.0 }, { +1.0 } };
+  return { 0.08, offsets, directions };
+} // makeTable()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ConversionTestCase ) {
+
+  detinfo::XTicksTable const table = makeTable();
+  detinfo::FixedXTicksTable<3U, 2U, 2U> const fixed{ table };
+
+  BOOST_TEST( fixed.HasPlane(1, 0, 1));
+  BOOST_TEST(!fixed.HasPlane(2, 0, 1));
+  BOOST_TEST(!fixed.HasPlane(0, 1, 1));
+
+  std::vector<double> const ticks{ -20.0, 0.0, 15.5, 1234.5, 4095.0 };
+  std::vector<double> x(ticks.size()), backTicks(ticks.size());
+  for (unsigned int c = 0; c < table.NCryostats(); ++c) {
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t) {
+      BOOST_TEST(fixed.Coefficient(t, c) == table.Coefficient(t, c));
+      for (unsigned int p = 0; p < table.NPlanes(t, c); ++p) {
+        BOOST_TEST(fixed.Offset(p, t, c) == table.Offset(p, t, c));
+
+        fixed.TicksToX(ticks.data(), ticks.size(), x.data(), p, t, c);
+        fixed.XToTicks(x.data(), x.size(), backTicks.data(), p, t, c);
+        for (std::size_t i = 0; i < ticks.size(); ++i) {
+          BOOST_TEST(fixed.TicksToX(ticks[i], p, t, c) == table.TicksToX(ticks[i], p, t, c));
+          BOOST_TEST(fixed.XToTicks(x[i], p, t, c) == table.XToTicks(x[i], p, t, c));
+          BOOST_TEST(x[i] == table.TicksToX(ticks[i], p, t, c));
+          BOOST_TEST(backTicks[i] == ticks[i], boost::test_tools::tolerance(1e-12));
+        }
+      } // for planes
+    } // for TPCs
+  } // for cryostats
+
+} // BOOST_AUTO_TEST_CASE( ConversionTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( LayoutTestCase ) {
+
+  detinfo::XTicksTable const table = makeTable();
+
+  // larger capacity than needed is fine
+  BOOST_CHECK_NO_THROW((detinfo::FixedXTicksTable<4U, 3U, 2U>{ table }));
+
+  BOOST_CHECK_THROW((detinfo::FixedXTicksTable<2U, 2U, 2U>{ table }), std::length_error);
+  BOOST_CHECK_THROW((detinfo::FixedXTicksTable<3U, 1U, 2U>{ table }), std::length_error);
+  BOOST_CHECK_THROW((detinfo::FixedXTicksTable<3U, 2U>{ table }), std::length_error);
+
+} // BOOST_AUTO_TEST_CASE( LayoutTestCase )
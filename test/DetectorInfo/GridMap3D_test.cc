@@ -0,0 +1,178 @@
+/**
+ * @file   GridMap3D_test.cc
+ * @brief  Test of `detinfo::GridMap3D`.
+ * @see    `lardataalg/DetectorInfo/GridMap3D.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( GridMap3D_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/GridMap3D.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint32_t
+#include <cstdio> // std::remove()
+#include <cstring> // std::memcpy()
+#include <fstream>
+#include <iterator> // std::istreambuf_iterator
+#include <stdexcept> // std::invalid_argument, std::runtime_error
+#include <string>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// a linear function is reproduced exactly by trilinear interpolation
+double linear(double const x, double const y, double const z)
+  { return 0.5 + 0.01 * x - 0.002 * y + 0.003 * z; }
+
+// a 7 x 5 x 9 grid (not a multiple of the block size) with 10 cm spacing
+detinfo::GridMap3D makeLinearMap() {
+  detinfo::GridMap3D::Size_t const nNodes { 7U, 5U, 9U };
+  detinfo::GridMap3D::Vector_t const origin { -30.0, -20.0, 0.0 };
+  detinfo::GridMap3D::Vector_t const spacing { 10.0, 10.0, 10.0 };
+  std::vector<double> values;
+  for (unsigned int k = 0; k < nNodes[2]; ++k)
+    for (unsigned int j = 0; j < nNodes[1]; ++j)
+      for (unsigned int i = 0; i < nNodes[0]; ++i)
+        values.push_back(linear(
+          origin[0] + i * spacing[0],
+          origin[1] + j * spacing[1],
+          origin[2] + k * spacing[2]
+        ));
+  return { nNodes, origin, spacing, values };
+} // makeLinearMap()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( InterpolationTestCase ) {
+
+  detinfo::GridMap3D const map = makeLinearMap();
+
+  BOOST_TEST(map.NodeValue(0, 0, 0) == linear(-30.0, -20.0, 0.0));
+  BOOST_TEST(map.NodeValue(6, 4, 8) == linear(30.0, 20.0, 80.0));
+
+  std::vector<double> x, y, z;
+  for (double px = -29.0; px < 30.0; px += 4.3)
+    for (double py = -19.5; py < 20.0; py += 3.7)
+      for (double pz = 0.2; pz < 80.0; pz += 6.1) {
+        x.push_back(px);
+        y.push_back(py);
+        z.push_back(pz);
+      }
+
+  std::vector<double> values(x.size());
+  map.Interpolate(x.data(), y.data(), z.data(), x.size(), values.data());
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    BOOST_TEST(values[i] == linear(x[i], y[i], z[i]), boost::test_tools::tolerance(1e-12));
+    BOOST_TEST(map(x[i], y[i], z[i]) == values[i]);
+  }
+
+  // outside the grid, the value on the border is returned
+  BOOST_TEST(map(-50.0, 0.0, 40.0) == linear(-30.0, 0.0, 40.0),
+    boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(map(0.0, 0.0, 100.0) == linear(0.0, 0.0, 80.0),
+    boost::test_tools::tolerance(1e-12));
+
+} // BOOST_AUTO_TEST_CASE( InterpolationTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( FileTestCase ) {
+
+  detinfo::GridMap3D const map = makeLinearMap();
+
+  char const* fileName = "GridMap3D_test.bin";
+  map.WriteTo(fileName);
+  detinfo::GridMap3D const read = detinfo::GridMap3D::ReadFrom(fileName);
+  std::remove(fileName);
+
+  BOOST_TEST(read.NNodes() == map.NNodes());
+  BOOST_TEST(read.Origin() == map.Origin());
+  BOOST_TEST(read.Spacing() == map.Spacing());
+  for (unsigned int k = 0; k < map.NNodes()[2]; ++k)
+    for (unsigned int j = 0; j < map.NNodes()[1]; ++j)
+      for (unsigned int i = 0; i < map.NNodes()[0]; ++i)
+        BOOST_TEST(read.NodeValue(i, j, k) == map.NodeValue(i, j, k));
+
+  BOOST_CHECK_THROW
+    (detinfo::GridMap3D::ReadFrom("GridMap3D_test_missing.bin"), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE( FileTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( InvalidFileTestCase ) {
+
+  // header: magic (8 bytes), version (4), nodes (3 x 4), origin (3 x 8), spacing (3 x 8)
+  std::size_t const nodesOffset = 12U, spacingOffset = 48U, headerSize = 72U;
+
+  char const* fileName = "GridMap3D_test_invalid.bin";
+  makeLinearMap().WriteTo(fileName);
+  std::string content;
+  {
+    std::ifstream file{ fileName, std::ios::binary };
+    content.assign(std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{});
+  }
+  BOOST_TEST(content.size() == headerSize + 7U * 5U * 9U * sizeof(double));
+
+  // writes `content` modified by `change` and returns whether reading it fails
+  auto const readFails = [&](auto change) {
+    std::string modified = content;
+    change(modified);
+    std::ofstream{ fileName, std::ios::binary } << modified;
+    try {
+      detinfo::GridMap3D::ReadFrom(fileName);
+      return false;
+    }
+    catch (std::runtime_error const&) {
+      return true;
+    }
+  };
+  auto const setNodes = [nodesOffset](std::string& data, std::uint32_t const n) {
+    for (unsigned int axis = 0; axis < 3U; ++axis)
+      std::memcpy(data.data() + nodesOffset + axis * sizeof(n), &n, sizeof(n));
+  };
+
+  BOOST_TEST(!readFails([](std::string&) {}));
+  // too few nodes
+  BOOST_TEST(readFails([&](std::string& data) { setNodes(data, 1U); }));
+  // non-positive spacing
+  BOOST_TEST(readFails([spacingOffset](std::string& data) {
+    double const spacing = 0.0;
+    std::memcpy(data.data() + spacingOffset, &spacing, sizeof(spacing));
+  }));
+  // the number of values overflows
+  BOOST_TEST(readFails([&](std::string& data) { setNodes(data, 0xFFFFFFFFU); }));
+  // very large, but not allocated since the file is too short
+  BOOST_TEST(readFails([&](std::string& data) { setNodes(data, 0x00100000U); }));
+  // truncated header, truncated values, extra data
+  BOOST_TEST(readFails([&](std::string& data) { data.resize(headerSize - 4U); }));
+  BOOST_TEST(readFails([](std::string& data) { data.resize(data.size() - sizeof(double)); }));
+  BOOST_TEST(readFails([](std::string& data) { data.append(sizeof(double), '\0'); }));
+
+  std::remove(fileName);
+
+} // BOOST_AUTO_TEST_CASE( InvalidFileTestCase )
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( TransformTestCase ) {
+
+  detinfo::GridMap3D const map = makeLinearMap();
+  detinfo::GridMap3D const doubled
+    = map.Transformed([](double const value){ return 2.0 * value; });
+  BOOST_TEST(doubled(1.0, 2.0, 3.0) == 2.0 * map(1.0, 2.0, 3.0),
+    boost::test_tools::tolerance(1e-12));
+
+  BOOST_CHECK_THROW(
+    detinfo::GridMap3D({ 1U, 2U, 2U }, { 0., 0., 0. }, { 1., 1., 1. }, std::vector<double>(4)),
+    std::invalid_argument
+    );
+  BOOST_CHECK_THROW(
+    detinfo::GridMap3D({ 2U, 2U, 2U }, { 0., 0., 0. }, { 1., 1., 1. }, std::vector<double>(7)),
+    std::invalid_argument
+    );
+
+} // BOOST_AUTO_TEST_CASE( TransformTestCase )
@@ -0,0 +1,126 @@
+/**
+ * @file   HitTimeConverter_test.cc
+ * @brief  Test of `detinfo::HitTimeConverter`.
+ * @see    `lardataalg/DetectorInfo/HitTimeConverter.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( HitTimeConverter_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+#include "lardataalg/DetectorInfo/HitTimeConverter.h"
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// minimal provider with constant values; only the conversion table matters
+class MockDetectorProperties: public detinfo::DetectorProperties {
+public:
+  double Efield(unsigned int = 0) const override { return 0.5; }
+  double DriftVelocity(double = 0., double = 0.) const override { return 0.16; }
+  double BirksCorrection(double dQdX) const override { return dQdX; }
+  double BirksCorrection(double dQdX, double) const override { return dQdX; }
+  double ModBoxCorrection(double dQdX) const override { return dQdX; }
+  double ModBoxCorrection(double dQdX, double) const override { return dQdX; }
+  double ElectronLifetime() const override { return 3000.0; }
+  double Density(double) const override { return 1.39; }
+  double Temperature() const override { return 87.0; }
+  double Eloss(double, double, double) const override { return 2.1; }
+  double ElossVar(double, double) const override { return 0.1; }
+  double ElectronsToADC() const override { return 6.8906513e-3; }
+  unsigned int NumberTimeSamples() const override { return 4492; }
+  unsigned int ReadOutWindowSize() const override { return 4492; }
+  double TimeOffsetU() const override { return 0.0; }
+  double TimeOffsetV() const override { return 0.0; }
+  double TimeOffsetZ() const override { return 0.0; }
+  bool SimpleBoundary() const override { return true; }
+  detinfo::DetectorPropertiesData DataFor(detinfo::DetectorClocksData const&) const override
+    { return makeData(); }
+
+  // two cryostats: the first with two 3-plane TPCs, the second with a 2-plane one
+  detinfo::DetectorPropertiesData makeData() const {
+    std::vector<std::vector<std::vector<double>>> const offsets{
+      { { 10.0, 11.0, 12.0 }, { 20.0, 21.0, 22.0 } },
+      { { 30.0, 31.0 } }
+      };
+    std::vector<std::vector<double>> const directions{ { +1.0, -1.0 }, { +1.0 } };
+    return detinfo::DetectorPropertiesData{
+      *this, 0.08, detinfo::XTicksTable{ 0.08, offsets, directions }
+      };
+  }
+}; // MockDetectorProperties
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( ConversionTestCase ) {
+
+  auto const tol = boost::test_tools::tolerance(1e-9);
+
+  MockDetectorProperties const detp;
+  detinfo::DetectorPropertiesData const detProp = detp.makeData();
+  detinfo::DetectorClocksData const clockData{
+    -1100.0, -1600.0, 1.25, 1.5,
+    detinfo::ElecClock{ 10.0, 1600.0, 2.0 },
+    detinfo::ElecClock{ 11.0, 1600.0, 64.0 },
+    detinfo::ElecClock{ 12.0, 1600.0, 16.0 },
+    detinfo::ElecClock{ 13.0, 1600.0, 31.25 }
+    };
+
+  detinfo::HitTimeConverter const converter{ clockData, detProp };
+
+  BOOST_TEST( converter.HasPlane(geo::PlaneID{ 0, 1, 2 }));
+  BOOST_TEST( converter.HasPlane(geo::PlaneID{ 1, 0, 1 }));
+  BOOST_TEST(!converter.HasPlane(geo::PlaneID{ 1, 0, 2 }));
+  BOOST_TEST(!converter.HasPlane(geo::PlaneID{ 1, 1, 0 }));
+  BOOST_TEST(!converter.HasPlane(geo::PlaneID{ 2, 0, 0 }));
+
+  std::vector<double> const ticks{ -20.0, 0.5, 15.5, 1234.5, 4095.0 };
+  for (double const tick: ticks) {
+    double const elecTime = clockData.TPCTick2Time(tick);
+    double const trigTime = clockData.TPCTick2TrigTime(tick);
+    BOOST_TEST(converter.TickToElecTime(tick) == elecTime, tol);
+    BOOST_TEST(converter.TickToTrigTime(tick) == trigTime, tol);
+    BOOST_TEST(converter.ElecTimeToTick(elecTime) == clockData.Time2Tick(elecTime), tol);
+    BOOST_TEST(converter.TrigTimeToTick(trigTime) == tick, tol);
+    BOOST_TEST(converter.TrigTimeToElecTime(trigTime) == elecTime, tol);
+    BOOST_TEST(converter.ElecTimeToTrigTime(elecTime) == trigTime, tol);
+  } // for ticks
+
+  std::vector<double> results(ticks.size());
+  for (geo::PlaneID const& planeid: {
+    geo::PlaneID{ 0, 0, 0 }, geo::PlaneID{ 0, 1, 2 }, geo::PlaneID{ 1, 0, 1 }
+  }) {
+    for (double const tick: ticks) {
+      double const x = detProp.ConvertTicksToX(tick, planeid);
+      double const elecTime = clockData.TPCTick2Time(tick);
+      double const trigTime = clockData.TPCTick2TrigTime(tick);
+      BOOST_TEST(converter.TickToX(tick, planeid) == x, tol);
+      BOOST_TEST(converter.XToTick(x, planeid) == tick, tol);
+      BOOST_TEST(converter.ElecTimeToX(elecTime, planeid) == x, tol);
+      BOOST_TEST(converter.XToElecTime(x, planeid) == elecTime, tol);
+      BOOST_TEST(converter.TrigTimeToX(trigTime, planeid) == x, tol);
+      BOOST_TEST(converter.XToTrigTime(x, planeid) == trigTime, tol);
+    } // for ticks
+
+    // batch, in place
+    results = ticks;
+    converter.TickToX(results.data(), results.size(), results.data(), planeid);
+    converter.XToTrigTime(results.data(), results.size(), results.data(), planeid);
+    converter.TrigTimeToX(results.data(), results.size(), results.data(), planeid);
+    converter.XToElecTime(results.data(), results.size(), results.data(), planeid);
+    converter.ElecTimeToX(results.data(), results.size(), results.data(), planeid);
+    converter.XToTick(results.data(), results.size(), results.data(), planeid);
+    for (std::size_t i = 0; i < ticks.size(); ++i)
+      BOOST_TEST(results[i] == ticks[i], tol);
+  } // for planes
+
+} // BOOST_AUTO_TEST_CASE( ConversionTestCase )
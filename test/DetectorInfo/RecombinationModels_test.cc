@@ -0,0 +1,84 @@
+/**
+ * @file   RecombinationModels_test.cc
+ * @brief  Test of `detinfo::BirksModel` and `detinfo::ModBoxModel`.
+ * @see    `lardataalg/DetectorInfo/RecombinationModels.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RecombinationModels_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/RecombinationModels.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::exp()
+
+
+//------------------------------------------------------------------------------
+// argon density [g/cm^3] and fields [kV/cm] the models are tested with
+constexpr double Density = 1.3954;
+constexpr double Fields[] = { 0.273, 0.5, 0.7, 1.0 };
+
+// energy losses [MeV/cm] from a minimum ionizing particle to a stopping proton
+constexpr double EnergyLosses[] = { 1.5, 2.1, 5.0, 10.0, 20.0, 30.0 };
+
+
+//------------------------------------------------------------------------------
+template <typename Model>
+void roundTripTest() {
+
+  for (double const field: Fields) {
+    Model const model { Density, field };
+    for (double const dEdx: EnergyLosses) {
+      BOOST_TEST_CONTEXT("E=" << field << " kV/cm, dE/dx=" << dEdx << " MeV/cm") {
+        double const dQdx = model.Charge(dEdx);
+        BOOST_TEST(dQdx > 0.0);
+        // recombination takes away charge: less than W/dE
+        BOOST_TEST(dQdx < dEdx / detinfo::RecombinationWion);
+        BOOST_TEST(model.EnergyLoss(dQdx) == dEdx, boost::test_tools::tolerance(1e-12));
+      }
+    } // for dE/dx
+
+    // charge increases with energy loss
+    double previous = 0.0;
+    for (double const dEdx: EnergyLosses) {
+      double const dQdx = model.Charge(dEdx);
+      BOOST_TEST(dQdx > previous);
+      previous = dQdx;
+    }
+  } // for fields
+
+} // roundTripTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( BirksRoundTripTestCase ) {
+  roundTripTest<detinfo::BirksModel>();
+}
+
+BOOST_AUTO_TEST_CASE( ModBoxRoundTripTestCase ) {
+  roundTripTest<detinfo::ModBoxModel>();
+}
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( RecombinationValuesTestCase ) {
+
+  constexpr double Wion = 1000. / util::kGeVToElectrons;
+  constexpr double E = 0.5;
+  constexpr double dQdx = 60000.0;
+
+  // the forward formulae, as spelled out in the papers
+  double const expectedBirks
+    = dQdx / (util::kRecombA / Wion - util::kRecombk / (Density * E) * dQdx);
+  double const beta = util::kModBoxB / (Density * E);
+  double const expectedModBox = (std::exp(beta * Wion * dQdx) - util::kModBoxA) / beta;
+
+  BOOST_TEST(detinfo::BirksModel(Density, E).EnergyLoss(dQdx) == expectedBirks,
+    boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(detinfo::ModBoxModel(Density, E).EnergyLoss(dQdx) == expectedModBox,
+    boost::test_tools::tolerance(1e-12));
+
+} // BOOST_AUTO_TEST_CASE( RecombinationValuesTestCase )
@@ -0,0 +1,104 @@
+/**
+ * @file   XTicksTable_benchmark.cc
+ * @brief  Throughput of scalar and batch ticks/drift coordinate conversions.
+ * @see    `lardataalg/DetectorInfo/XTicksTable.h`
+ *
+ * Usage: `XTicksTable_benchmark [NHits] [NRepetitions]`
+ *
+ * The program converts `NHits` ticks into drift coordinates, first with a
+ * loop of single conversions, then with the batch interface on one plane,
+ * then with the batch interface on (tick, plane) pairs, and prints the
+ * throughput of each. It fails if the results are not the same.
+ * It is built and run only by the `benchmark` target of the build.
+ */
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <chrono>
+#include <cstdlib> // std::strtoul()
+#include <iomanip> // std::setw()
+#include <iostream>
+#include <limits> // std::numeric_limits<>
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+namespace {
+
+  /// Runs `f` `nRepetitions` times, returns the best time per run [s].
+  template <typename F>
+  double
+  bestTime(unsigned int const nRepetitions, F&& f)
+  {
+    using clock_t = std::chrono::steady_clock;
+    double best = std::numeric_limits<double>::max();
+    for (unsigned int i = 0; i < nRepetitions; ++i) {
+      auto const start = clock_t::now();
+      f();
+      std::chrono::duration<double> const elapsed = clock_t::now() - start;
+      if (elapsed.count() < best) best = elapsed.count();
+    }
+    return best;
+  }
+
+  void
+  report(std::string const& name, std::size_t const nHits, double const time)
+  {
+    std::cout << std::setw(28) << name << ": " << std::setw(10) << (time * 1e9 / nHits)
+              << " ns/hit, " << std::setw(10) << (nHits / time * 1e-6) << " Mhit/s" << std::endl;
+  }
+
+} // local namespace
+
+int
+main(int argc, char const** argv)
+{
+  std::size_t const nHits = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1'000'000U;
+  unsigned int const nRepetitions = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 10U;
+
+  // a 1-cryostat, 4-TPC, 3-plane detector
+  std::vector<std::vector<std::vector<double>>> offsets(1);
+  std::vector<std::vector<double>> directions(1);
+  for (unsigned int t = 0; t < 4; ++t) {
+    offsets[0].push_back({3200.0 + t, 3204.0 + t, 3208.0 + t});
+    directions[0].push_back((t % 2) ? -1.0 : +1.0);
+  }
+  detinfo::XTicksTable const table{0.0802, offsets, directions};
+
+  geo::PlaneID const plane{0, 1, 2};
+  std::vector<double> ticks(nHits);
+  std::vector<std::pair<double, geo::PlaneID>> hits(nHits);
+  for (std::size_t i = 0; i < nHits; ++i) {
+    ticks[i] = static_cast<double>(i % 6400);
+    hits[i] = {ticks[i], plane};
+  }
+
+  std::vector<double> xScalar(nHits), xBatch(nHits), xPairs(nHits);
+
+  double const scalarTime = bestTime(nRepetitions, [&] {
+    for (std::size_t i = 0; i < nHits; ++i)
+      xScalar[i] = table.TicksToX(ticks[i], plane.Plane, plane.TPC, plane.Cryostat);
+  });
+  double const batchTime = bestTime(nRepetitions, [&] {
+    table.TicksToX(ticks.data(), nHits, xBatch.data(), plane.Plane, plane.TPC, plane.Cryostat);
+  });
+  double const pairsTime =
+    bestTime(nRepetitions, [&] { table.TicksToX(hits.data(), nHits, xPairs.data()); });
+
+  std::cout << "Converting " << nHits << " ticks (best of " << nRepetitions << " runs)\n";
+  report("scalar loop", nHits, scalarTime);
+  report("batch, single plane", nHits, batchTime);
+  report("batch, (tick, plane) pairs", nHits, pairsTime);
+  std::cout << "Speedup of single plane batch: " << (scalarTime / batchTime) << std::endl;
+
+  unsigned int nErrors = 0;
+  for (std::size_t i = 0; i < nHits; ++i) {
+    if ((xBatch[i] != xScalar[i]) || (xPairs[i] != xScalar[i])) ++nErrors;
+  }
+  if (nErrors > 0) std::cerr << nErrors << " conversions differ between methods!" << std::endl;
+
+  return (nErrors > 0) ? 1 : 0;
+} // main()
@@ -0,0 +1,106 @@
+/**
+ * @file   XTicksTable_test.cc
+ * @brief  Test of `detinfo::XTicksTable`.
+ * @see    `lardataalg/DetectorInfo/XTicksTable.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( XTicksTable_test )
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/XTicksTable.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::uintptr_t
+#include <stdexcept> // std::out_of_range
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+void nestedConstructionTest() {
+
+  // two cryostats: the first with two 3-plane TPCs, the second with a 2-plane one
+  std::vector<std::vector<std::vector<double>>> const offsets{
+    { { 10.0, 11.0, 12.0 }, { 20.0, 21.0, 22.0 } },
+    { { 30.0, 31.0 } }
+    };
+  std::vector<std::vector<double>> const directions{ { +1.0, -1.0 }, { +1.0 } };
+  double const coefficient = 0.08; // cm/tick
+
+  detinfo::XTicksTable const table{ coefficient, offsets, directions };
+
+  BOOST_TEST(table.NCryostats() == 2U);
+  BOOST_TEST(table.NTPCs(0) == 2U);
+  BOOST_TEST(table.NTPCs(1) == 1U);
+  BOOST_TEST(table.NTPCs(2) == 0U);
+  BOOST_TEST(table.NPlanes(1, 0) == 3U);
+  BOOST_TEST(table.NPlanes(0, 1) == 2U);
+  BOOST_TEST(table.NPlanes(1, 1) == 0U);
+  BOOST_TEST( table.HasPlane(1, 0, 1));
+  BOOST_TEST(!table.HasPlane(2, 0, 1));
+
+  // each row fits a cache line, and rows start on cache line boundaries
+  BOOST_TEST(table.RowSize() == detinfo::XTicksTable::LineSize);
+  for (unsigned int c = 0; c < table.NCryostats(); ++c) {
+    for (unsigned int t = 0; t < table.NTPCs(c); ++t) {
+      auto const address = reinterpret_cast<std::uintptr_t>(table.Row(t, c));
+      BOOST_TEST(address % util::CacheLineSize == 0U);
+    }
+  }
+
+  for (unsigned int c = 0; c < offsets.size(); ++c) {
+    for (unsigned int t = 0; t < offsets[c].size(); ++t) {
+      double const k = coefficient * directions[c][t];
+      BOOST_TEST(table.Coefficient(t, c) == k);
+      BOOST_TEST(table.CoefficientAt(t, c) == k);
+      for (unsigned int p = 0; p < offsets[c][t].size(); ++p) {
+        double const offset = offsets[c][t][p];
+        BOOST_TEST(table.Offset(p, t, c) == offset);
+        BOOST_TEST(table.OffsetAt(p, t, c) == offset);
+
+        double const ticks = 1234.5;
+        double const x = (ticks - offset) * k;
+        BOOST_TEST(table.TicksToX(ticks, p, t, c) == x);
+        BOOST_TEST(table.XToTicks(x, p, t, c) == ticks,
+                   boost::test_tools::tolerance(1e-12));
+      } // for planes
+    } // for TPCs
+  } // for cryostats
+
+  BOOST_CHECK_THROW(table.OffsetAt(2, 0, 1), std::out_of_range);
+  BOOST_CHECK_THROW(table.OffsetAt(0, 2, 0), std::out_of_range);
+  BOOST_CHECK_THROW(table.CoefficientAt(0, 2), std::out_of_range);
+
+} // nestedConstructionTest()
+
+
+//------------------------------------------------------------------------------
+void layoutConstructionTest() {
+
+  // a TPC with more planes than a single cache line can hold
+  detinfo::XTicksTable table{ { { 3U, 9U } } };
+
+  BOOST_TEST(table.RowSize() == 2U * detinfo::XTicksTable::LineSize);
+  BOOST_TEST(table.NPlanes(1, 0) == 9U);
+
+  table.SetCoefficient(1, 0, -0.5);
+  for (unsigned int p = 0; p < 9U; ++p) table.SetOffset(p, 1, 0, 100.0 * p);
+
+  BOOST_TEST(table.Coefficient(1, 0) == -0.5);
+  BOOST_TEST(table.Offset(8, 1, 0) == 800.0);
+  BOOST_TEST(table.TicksToX(810.0, 8, 1, 0) == -5.0);
+  BOOST_TEST(table.Offset(2, 0, 0) == 0.0);
+
+  BOOST_CHECK_THROW(table.SetOffset(3, 0, 0, 1.0), std::out_of_range);
+
+} // layoutConstructionTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE( XTicksTableTestCase ) {
+
+  nestedConstructionTest();
+  layoutConstructionTest();
+
+} // BOOST_AUTO_TEST_CASE( XTicksTableTestCase )